@@ -0,0 +1,209 @@
+/**
+ * @file holder.hpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief rapidjson snapshots holder
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+
+#ifndef _UTILITIES_HOLDER_HPP_
+#define _UTILITIES_HOLDER_HPP_
+
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "rapidjson.hpp"
+
+namespace utilities {
+
+
+/**
+ * @brief Holder publishing immutable rapidjson snapshots (RCU style)
+ * 
+ * Readers pin the current snapshot without lock and only get const access.
+ * Writers are serialized: a new snapshot is published with an atomic swap,
+ * then the previous one is freed once the readers which may have pinned it
+ * are done. Readers never wait for a writer.
+ */
+class holder
+{
+public:
+    /**
+     * @brief Pin of the current snapshot (RAII)
+     */
+    class reader
+    {
+    public:
+        /**
+         * @brief Pin the current snapshot
+         * 
+         * @param holderRef Snapshots holder
+         */
+        explicit reader(holder& holderRef);
+
+        /**
+         * @brief Release the pinned snapshot
+         */
+        ~reader();
+
+        reader(const reader&) = delete;
+        reader& operator=(const reader&) = delete;
+
+        /**
+         * @brief Get the pinned snapshot
+         * 
+         * @return const rapidjson& Processing result
+         */
+        const rapidjson& json() const;
+
+        /**
+         * @brief Access the pinned snapshot
+         * 
+         * @return const rapidjson* Processing result
+         */
+        const rapidjson* operator->() const;
+
+    private:
+        /**
+         * @brief Snapshots holder
+         */
+        holder& m_holder;
+
+        /**
+         * @brief Readers counter the pin is registered in
+         */
+        uint32_t m_uiCounter {0};
+
+        /**
+         * @brief Pinned snapshot
+         */
+        const rapidjson* m_pJson {nullptr};
+    };
+
+    /**
+     * @brief Options applied to every new snapshot
+     * 
+     * A snapshot is a new rapidjson object, so the parse options, the parse
+     * front-end and the member index threshold of the file are set here once
+     * and reused by each load (and each watcher reload).
+     */
+    struct stSnapshotConfig
+    {
+        rapidjson::stParseConfig parseConfig;
+        rapidjson::PARSER        eParser     {rapidjson::PARSER::READER};
+        uint32_t                 uiIndex     {0};
+    };
+
+    /**
+     * @brief Construct a new holder object, with an empty snapshot
+     * 
+     * @param strFilePath JSON file path
+     * @param cNodePathSeparator Node path separator
+     */
+    holder(const std::string& strFilePath = "", const char& cNodePathSeparator = '.');
+
+    /**
+     * @brief Construct a new holder object, with an empty snapshot and snapshot options
+     * 
+     * @param strFilePath JSON file path
+     * @param cNodePathSeparator Node path separator
+     * @param snapshotConfig Options applied to every new snapshot
+     */
+    holder(const std::string& strFilePath, const char& cNodePathSeparator, const stSnapshotConfig& snapshotConfig);
+
+    /**
+     * @brief Destroy the holder object (no reader may be alive)
+     */
+    virtual ~holder();
+
+    holder(const holder&) = delete;
+    holder& operator=(const holder&) = delete;
+
+    /**
+     * @brief Pin the current snapshot
+     * 
+     * @return reader Processing result
+     */
+    reader read();
+
+    /**
+     * @brief Load the json file into a new snapshot and publish it
+     * 
+     * @param strFilePath JSON file path
+     * @param eLoad File load mode
+     * @return int Processing result
+     */
+    int load(const std::string& strFilePath = "", const rapidjson::LOAD& eLoad = rapidjson::LOAD::STREAM);
+
+    /**
+     * @brief Load the json file into a new snapshot, check it and publish it
+     * 
+     * @param schema Compiled nodes configuration
+     * @param vecCheckRet Check result vector
+     * @param strFilePath JSON file path
+     * @param eLoad File load mode
+     * @return int Processing result
+     */
+    int load(const rapidjson::stSchema& schema, std::vector<std::pair<std::string, rapidjson::CHECK_ERROR>>& vecCheckRet, const std::string& strFilePath = "", const rapidjson::LOAD& eLoad = rapidjson::LOAD::STREAM);
+
+    /**
+     * @brief Publish a snapshot, free the previous one once its readers are done
+     * 
+     * @param pJson New snapshot
+     * @return int Processing result
+     */
+    int publish(std::unique_ptr<rapidjson>&& pJson);
+
+private:
+    /**
+     * @brief Create a new snapshot with the snapshot options
+     * 
+     * @param strFilePath JSON file path
+     * @return std::unique_ptr<rapidjson> Processing result
+     */
+    std::unique_ptr<rapidjson> create(const std::string& strFilePath) const;
+
+    /**
+     * @brief JSON file path
+     */
+    std::string m_strFilePath;
+
+    /**
+     * @brief Node path separator
+     */
+    const char m_cNodePathSeparator;
+
+    /**
+     * @brief Options applied to every new snapshot
+     */
+    const stSnapshotConfig m_snapshotConfig;
+
+    /**
+     * @brief Current snapshot
+     */
+    std::atomic<rapidjson*> m_pSnapshot {nullptr};
+
+    /**
+     * @brief Readers counters, the epoch parity selects the counter of the new readers
+     */
+    std::atomic<uint32_t> m_auiReaders[2];
+
+    /**
+     * @brief Publication epoch
+     */
+    std::atomic<uint32_t> m_uiEpoch {0};
+
+    /**
+     * @brief Serialize the writers
+     */
+    std::mutex m_mutexWriter;
+};
+
+
+} // namespace utilities
+
+#endif //_UTILITIES_HOLDER_HPP_
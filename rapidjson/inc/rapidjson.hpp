@@ -14,7 +14,12 @@
 
 
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <string>
+#include <string_view>
+#include <cstdio>
 #include "document.h"
 #include "writer.h"
 #include "stringbuffer.h"
@@ -22,15 +27,38 @@
 #include <iostream>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <limits>
+#include <cmath>
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <cerrno>
+#include <type_traits>
 #include "filewritestream.h"
 #include "prettywriter.h"
 #include "filereadstream.h"
+#include "memorystream.h"
 #include "error/en.h"
+#include "scanner.hpp"
 
 namespace utilities {
 
 
+/**
+ * @brief rapidjson helper
+ * 
+ * Const members (get / getType / exist / empty / size / getElements / compile)
+ * may be called concurrently from any number of threads without lock, as long
+ * as no non-const member runs at the same time.
+ */
 class rapidjson
 {
 public:
@@ -57,6 +85,34 @@ public:
         INT     = SINT   | UINT
     };
 
+    /**
+     * @brief Enumeration of array write modes
+     */
+    enum class SET_MODE: uint8_t
+    {
+        REPLACE = 0,
+        APPEND  = 1
+    };
+
+    /**
+     * @brief Enumeration of parse front-ends
+     */
+    enum class PARSER: uint8_t
+    {
+        READER = 0,
+        SIMD   = 1
+    };
+
+    /**
+     * @brief Enumeration of file load modes
+     */
+    enum class LOAD: uint8_t
+    {
+        STREAM = 0,
+        MMAP   = 1,
+        LAZY   = 2
+    };
+
     /**
      * @brief Enumeration of json processing
      */
@@ -75,11 +131,7 @@ public:
             REMOVE   = 4,
             SIZE     = 5,
             EXIST    = 6,
-            EMPTY    = 7,
-            SETINT   = 8,
-            SETUINT  = 9,
-            SETINT64 = 10,
-            SETUINT64= 11
+            EMPTY    = 7
         };
 
         TYPE eType{TYPE::SET};
@@ -112,20 +164,176 @@ public:
 
     /**
      * @brief Task callback function type
+     * 
+     * Called by check() while the document is read only: the callback may
+     * read the document but not modify it.
      */
     typedef std::function<int(rapidjson& json, const std::string& strNode, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)> tCallback;
 
+    /**
+     * @brief Read only task callback function type
+     * 
+     * Called by check() with the document const: it can only read, so it is
+     * safe from the parallel workers. Used instead of callback when set.
+     */
+    typedef std::function<int(const rapidjson& json, const std::string& strNode, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)> tConstCallback;
+
     /**
      * @brief node Configuration structure
      */
     struct stNodeConfig
     {
-        bool                                 bOptional    {false};
-        bool                                 bNull        {false};
-        bool                                 bEmpty       {false};
-        TYPE                                 eType        {TYPE::UKNOWN};
-        tCallback                            callback     {nullptr};
-        std::map<std::string, stNodeConfig>* mapNodeItems {nullptr};
+        bool                                 bOptional     {false};
+        bool                                 bNull         {false};
+        bool                                 bEmpty        {false};
+        TYPE                                 eType         {TYPE::UKNOWN};
+        tCallback                            callback      {nullptr};
+        std::map<std::string, stNodeConfig>* mapNodeItems  {nullptr};
+        tConstCallback                       constCallback {nullptr};
+    };
+
+    /**
+     * @brief Compiled node path (see compile())
+     */
+    struct stPath
+    {
+        /**
+         * @brief Path segment
+         */
+        struct stSegment
+        {
+            std::string strName;
+            uint32_t    uiLength      {0};
+            uint32_t    uiHash        {0};
+            uint64_t    ulArrayElemnt {UINT64_MAX};
+        };
+
+        std::vector<stSegment> vecSegments;
+    };
+
+    /**
+     * @brief Compiled node configuration (see compile())
+     * 
+     * Rules are stored flat; the children of a rule are the contiguous range
+     * [uiFirstChild, uiFirstChild + uiChildCount) and the root rules are the
+     * range [0, uiRootCount). A compiled schema holds no reference to the
+     * configuration map nor to a document, it can be shared between
+     * documents and threads.
+     */
+    struct stSchema
+    {
+        /**
+         * @brief Validation rule of a node
+         */
+        struct stRule
+        {
+            std::string    strName;
+            stPath         path;
+            TYPE           eType         {TYPE::UKNOWN};
+            uint16_t       usTypeMask    {0};
+            bool           bOptional     {false};
+            bool           bNull         {false};
+            bool           bEmpty        {false};
+            tCallback      callback      {nullptr};
+            tConstCallback constCallback {nullptr};
+            uint32_t       uiFirstChild  {0};
+            uint32_t       uiChildCount  {0};
+        };
+
+        std::vector<stRule> vecRules;
+        uint32_t            uiRootCount {0};
+    };
+
+    /**
+     * @brief Check execution configuration
+     * 
+     * With more than one thread, the items of the arrays of objects of at
+     * least uiMinItems items are checked by parallel workers.
+     * In every mode the document is read only for the whole check (set /
+     * remove / load return -1) and so for the callbacks: the walk holds
+     * references to the nodes it checks. Callbacks may save / write, each
+     * output then uses its own buffer.
+     * The walk stops at the first error with bFailFast, or once uiMaxErrors
+     * errors are reported (0: no limit); the parallel workers share the error
+     * count, so the first errors stop all of them. The result vector is cleared, not
+     * released, so a reused vector keeps its capacity.
+     * With bStream, a configuration string is first validated while it is
+     * parsed (no DOM): the first violation rejects it and the document is
+     * left untouched; a valid string is then loaded and fully checked.
+     */
+    struct stCheckConfig
+    {
+        uint32_t uiThreads   {1};
+        uint32_t uiMinItems  {1024};
+        bool     bFailFast   {false};
+        uint32_t uiMaxErrors {0};
+        bool     bStream     {false};
+    };
+
+    /**
+     * @brief Output format
+     */
+    enum class FORMAT: uint8_t
+    {
+        COMPACT = 0,
+        PRETTY  = 1,
+        LINES   = 2
+    };
+
+    /**
+     * @brief Output format configuration
+     * 
+     * PRETTY indents with uiIndent cIndent characters (' ', '\t', '\n' or '\r'),
+     * any other character fails the output (-1).
+     * LINES writes a root array with one compact element per line, any other
+     * root compact.
+     */
+    struct stFormat
+    {
+        FORMAT   eFormat  {FORMAT::PRETTY};
+        char     cIndent  {' '};
+        uint32_t uiIndent {4};
+    };
+
+    /**
+     * @brief Save configuration
+     * 
+     * With bAtomic, the document is written to a temporary file of the target
+     * directory which is then renamed over the target: a crash leaves either
+     * the previous or the new file, never a truncated one. A symbolic link is
+     * resolved first, so its target is replaced and the link kept (a dangling
+     * link is replaced by the file).
+     * eSync flushes the written data to the disk (DATA: fdatasync, FULL: fsync)
+     * before the file is closed, and the directory after the rename.
+     */
+    struct stSaveConfig
+    {
+        enum class SYNC: uint8_t
+        {
+            NONE = 0,
+            DATA = 1,
+            FULL = 2
+        };
+
+        bool     bAtomic {true};
+        SYNC     eSync   {SYNC::NONE};
+        stFormat format;
+    };
+
+    /**
+     * @brief Parse options of load and set
+     * 
+     * The default is strict JSON with the fast number parse, which may be off
+     * by one unit in the last place of a double. bFullPrecision parses doubles
+     * exactly (slower). bRelaxed accepts C and C++ comments, a comma after the
+     * last member or element, and NaN, Inf and Infinity; NaN and infinite
+     * values are then also written back on output. A strict JSON text parses
+     * the same in both syntaxes.
+     */
+    struct stParseConfig
+    {
+        bool bRelaxed       {false};
+        bool bFullPrecision {false};
     };
 
     /**
@@ -144,15 +352,28 @@ public:
      * @brief Get JSON file path
      * @return std::string Processing result (File path)
      */
-    std::string path();
+    std::string path() const;
     
     /**
      * @brief load the json file
      * 
+     * STREAM copies the file content into the document; MMAP parses a private
+     * mapping of the file in situ, strings then reference the mapping which is
+     * owned by this object until the next load / set or its destruction.
+     * LAZY maps the file and indexes its brackets with the SIMD scanner
+     * (UTF-8 and strings checked, no document is built): path reads parse
+     * just the node they address and cache it, any other operation parses
+     * the whole document first. The values are validated as they are parsed:
+     * a malformed node reads as missing, a malformed document fails the
+     * operations on the whole document (-1) and keeps its lazy nodes.
+     * Lazy reads of parsed nodes share a lock, the first read of a node and
+     * the parse of the document take it exclusively.
+     * 
      * @param strFilePath JSON file path
+     * @param eLoad File load mode
      * @return int Processing result
      */
-    int load(const std::string& strFilePath = "");
+    int load(const std::string& strFilePath = "", const LOAD& eLoad = LOAD::STREAM);
 
     /**
      * @brief write and save the json file
@@ -162,13 +383,109 @@ public:
      */
     int save(const std::string& strFilePath = "");
 
+    /**
+     * @brief write and save the json file with a save configuration
+     * 
+     * @param strFilePath JSON file path
+     * @param saveConfig Save configuration
+     * @return int Processing result
+     */
+    int save(const std::string& strFilePath, const stSaveConfig& saveConfig);
+
     /**
      * @brief Get json string
      * 
      * @param bPrettyWriter JSON format writer status 
      * @return std::string Processing result
      */
-    std::string get(const bool& bPrettyWriter = false);
+    std::string get(const bool& bPrettyWriter = false) const;
+
+    /**
+     * @brief Append the json string to a caller buffer (its capacity is kept)
+     * 
+     * @param strOut Output buffer
+     * @param format Output format
+     * @return int Processing result
+     */
+    int get(std::string& strOut, const stFormat& format) const;
+
+    /**
+     * @brief Append the json string to a caller buffer (its capacity is kept)
+     * 
+     * @param jsonBuffer Output buffer
+     * @param format Output format
+     * @return int Processing result
+     */
+    int get(::rapidjson::StringBuffer& jsonBuffer, const stFormat& format) const;
+
+    /**
+     * @brief Get the json string in the output buffer of this object
+     * 
+     * The view is valid until the next call on this object. The buffer is
+     * shared: the view is empty while the document is read only (check).
+     * 
+     * @param format Output format
+     * @return std::string_view Processing result (empty on failure)
+     */
+    std::string_view get(const stFormat& format);
+
+    /**
+     * @brief Write the json string to a file descriptor
+     * 
+     * @param iFile File descriptor
+     * @param format Output format
+     * @return int Processing result
+     */
+    int write(const int& iFile, const stFormat& format);
+
+    /**
+     * @brief Write the json string to a file
+     * 
+     * @param pFile File
+     * @param format Output format
+     * @return int Processing result
+     */
+    int write(FILE* pFile, const stFormat& format);
+
+    /**
+     * @brief Get the json string of a node (the document is not copied)
+     * 
+     * @param strOut Node json string
+     * @param strNode JSON node path
+     * @param bPrettyWriter JSON format writer status
+     * @return int Processing result
+     */
+    int get(std::string& strOut, const std::string& strNode, const bool& bPrettyWriter) const;
+
+    /**
+     * @brief Append the json string of a node to a caller buffer
+     * 
+     * @param strOut Output buffer
+     * @param strNode JSON node path
+     * @param format Output format
+     * @return int Processing result
+     */
+    int get(std::string& strOut, const std::string& strNode, const stFormat& format) const;
+
+    /**
+     * @brief Write the json string of a node to a file descriptor
+     * 
+     * @param iFile File descriptor
+     * @param strNode JSON node path
+     * @param format Output format
+     * @return int Processing result
+     */
+    int write(const int& iFile, const std::string& strNode, const stFormat& format);
+
+    /**
+     * @brief Write the json string of a node to a file
+     * 
+     * @param pFile File
+     * @param strNode JSON node path
+     * @param format Output format
+     * @return int Processing result
+     */
+    int write(FILE* pFile, const std::string& strNode, const stFormat& format);
 
     /**
      * @brief Set json string
@@ -178,6 +495,31 @@ public:
      */
     int set(const std::string& strData);
 
+    /**
+     * @brief Set json string in situ
+     * 
+     * @param strData JSON data, kept by this object
+     * @return int Processing result
+     */
+    int set(std::string&& strData);
+
+    /**
+     * @brief Set json data in situ
+     * 
+     * @param vecData JSON data, kept by this object
+     * @return int Processing result
+     */
+    int set(std::vector<char>&& vecData);
+
+    /**
+     * @brief Set json data of a given length
+     * 
+     * @param pcData JSON data
+     * @param ulSize JSON data length
+     * @return int Processing result
+     */
+    int set(const char* pcData, const size_t& ulSize);
+
     /**
      * @brief Get JSON object value based its path
      * 
@@ -185,7 +527,19 @@ public:
      * @param strNode JSON node path
      * @return int Processing result
      */
-    int get(std::string& strValue, const std::string& strNode);
+    int get(std::string& strValue, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON object value based its path, without copy
+     * 
+     * The view references the document; it is valid until the next
+     * modification, load or set of this object.
+     * 
+     * @param svValue Value to retrieve
+     * @param strNode JSON node path
+     * @return int Processing result
+     */
+    int get(std::string_view& svValue, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -194,7 +548,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(int& iValue, const std::string& strNode);
+    int get(int& iValue, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -203,7 +557,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(uint64_t& ulValue, const std::string& strNode);
+    int get(uint64_t& ulValue, const std::string& strNode) const;
     
     /**
      * @brief Get JSON object value based its path
@@ -212,7 +566,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(uint32_t& uiValue, const std::string& strNode);
+    int get(uint32_t& uiValue, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -221,7 +575,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(uint16_t& usValue, const std::string& strNode);
+    int get(uint16_t& usValue, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -230,7 +584,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(uint8_t& ucValue, const std::string& strNode);
+    int get(uint8_t& ucValue, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -239,7 +593,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(int64_t& lValue, const std::string& strNode);
+    int get(int64_t& lValue, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -248,7 +602,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(int16_t& sValue, const std::string& strNode);
+    int get(int16_t& sValue, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -257,17 +611,19 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(int8_t& cValue, const std::string& strNode);
+    int get(int8_t& cValue, const std::string& strNode) const;
     
 
     /**
      * @brief Get JSON object value based its path
      * 
+     * Any number is read, a finite number out of the float range fails (-2).
+     * 
      * @param fValue Value to retrieve
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(float& fValue, const std::string& strNode);
+    int get(float& fValue, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -276,7 +632,7 @@ public:
      * @param strNode JSON node path
      * @return int Processing result
      */
-    int get(double& dValue, const std::string& strNode);
+    int get(double& dValue, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -285,7 +641,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(bool& bValue, const std::string& strNode);
+    int get(bool& bValue, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -294,7 +650,16 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<std::string>& vecValues, const std::string& strNode);
+    int get(std::vector<std::string>& vecValues, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON object value based its path, without copy
+     * 
+     * @param vecValues Value to retrieve (views valid until the next modification)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(std::vector<std::string_view>& vecValues, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -303,7 +668,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<uint64_t>& vecValues, const std::string& strNode);
+    int get(std::vector<uint64_t>& vecValues, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -312,7 +677,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<uint32_t>& vecValues, const std::string& strNode);
+    int get(std::vector<uint32_t>& vecValues, const std::string& strNode) const;
 
         /**
      * @brief Get JSON object value based its path
@@ -321,7 +686,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<uint16_t>& vecValues, const std::string& strNode);
+    int get(std::vector<uint16_t>& vecValues, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -330,7 +695,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<uint8_t>& vecValues, const std::string& strNode);
+    int get(std::vector<uint8_t>& vecValues, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -339,7 +704,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<int>& vecValues, const std::string& strNode);
+    int get(std::vector<int>& vecValues, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -348,7 +713,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<int64_t>& vecValues, const std::string& strNode);
+    int get(std::vector<int64_t>& vecValues, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -357,7 +722,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<int16_t>& vecValues, const std::string& strNode);
+    int get(std::vector<int16_t>& vecValues, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -366,7 +731,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<int8_t>& vecValues, const std::string& strNode);
+    int get(std::vector<int8_t>& vecValues, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -375,7 +740,7 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<float>& vecValues, const std::string& strNode);
+    int get(std::vector<float>& vecValues, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -384,7 +749,7 @@ public:
      * @param strNode JSON node path
      * @return int Processing result
      */
-    int get(std::vector<double>& vecValues, const std::string& strNode);
+    int get(std::vector<double>& vecValues, const std::string& strNode) const;
 
     /**
      * @brief Get JSON object value based its path
@@ -393,7 +758,107 @@ public:
      * @param strNode JSON node path 
      * @return int Processing result
      */
-    int get(std::vector<bool>& vecValues, const std::string& strNode);
+    int get(std::vector<bool>& vecValues, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its path
+     * 
+     * @param pdValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(double* pdValues, size_t& ulSize, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its path
+     * 
+     * @param pfValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(float* pfValues, size_t& ulSize, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its path
+     * 
+     * @param pulValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(uint64_t* pulValues, size_t& ulSize, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its path
+     * 
+     * @param puiValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(uint32_t* puiValues, size_t& ulSize, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its path
+     * 
+     * @param pusValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(uint16_t* pusValues, size_t& ulSize, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its path
+     * 
+     * @param pucValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(uint8_t* pucValues, size_t& ulSize, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its path
+     * 
+     * @param piValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(int* piValues, size_t& ulSize, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its path
+     * 
+     * @param plValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(int64_t* plValues, size_t& ulSize, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its path
+     * 
+     * @param psValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(int16_t* psValues, size_t& ulSize, const std::string& strNode) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its path
+     * 
+     * @param pcValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param strNode JSON node path 
+     * @return int Processing result
+     */
+    int get(int8_t* pcValues, size_t& ulSize, const std::string& strNode) const;
 
     /**
      * @brief Get the type of specific node
@@ -401,7 +866,7 @@ public:
      * @param strNode JSON node path 
      * @return JSON_TYPE type of the node
      */
-    TYPE getType(const std::string& strNode);
+    TYPE getType(const std::string& strNode) const;
 
     /**
      * @brief Set JSON object value based its path
@@ -526,108 +991,120 @@ public:
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<std::string>& vecValues, const std::string& strNode);
+    int set(const std::vector<std::string>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<uint64_t>& vecValues, const std::string& strNode);
+    int set(const std::vector<uint64_t>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<uint32_t>& vecValues, const std::string& strNode);
+    int set(const std::vector<uint32_t>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<uint16_t>& vecValues, const std::string& strNode);
+    int set(const std::vector<uint16_t>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<uint8_t>& vecValues, const std::string& strNode);
+    int set(const std::vector<uint8_t>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<int>& vecValues, const std::string& strNode);
+    int set(const std::vector<int>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<int64_t>& vecValues, const std::string& strNode);
+    int set(const std::vector<int64_t>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<int16_t>& vecValues, const std::string& strNode);
+    int set(const std::vector<int16_t>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<int8_t>& vecValues, const std::string& strNode);
+    int set(const std::vector<int8_t>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<float>& vecValues, const std::string& strNode);
+    int set(const std::vector<float>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<double>& vecValues, const std::string& strNode);
+    int set(const std::vector<double>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief Set JSON object value based its path
      * 
      * @param vecValues Value to retrieve
      * @param strNode JSON node path 
+     * @param eMode Array write mode
      * @return int Processing result
      */
-    int set(const std::vector<bool>& vecValues, const std::string& strNode);
+    int set(const std::vector<bool>& vecValues, const std::string& strNode, const SET_MODE& eMode = SET_MODE::REPLACE);
 
     /**
      * @brief remove JSON object value based its path
@@ -643,7 +1120,7 @@ public:
      * @param strNode JSON node path
      * @return bool Processing result
      */
-    bool empty(const std::string& strNode);
+    bool empty(const std::string& strNode) const;
 
     /**
      * @brief Verify JSON object exist or not  based its path
@@ -651,7 +1128,7 @@ public:
      * @param strNode JSON node path
      * @return bool Processing result
      */
-    bool exist(const std::string& strNode);
+    bool exist(const std::string& strNode) const;
     
     /**
      * @brief Get the Size object
@@ -659,101 +1136,1029 @@ public:
      * @param strNode JSON node path
      * @return uint32_t Processing result
      */
-    uint32_t size(const std::string& strNode);
+    uint32_t size(const std::string& strNode) const;
 
     /**
-     * @brief Check configuration
-     *
-     * @param strConfig Configuration string
-     * @param mapNodes Nodes map 
-     * @param vecCheckRet Check result vector
-     * @return int Processing result
-     */
-    int check(const std::string& strConfig, const std::map<std::string, stNodeConfig>& mapNodes, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
-    
-private:
-    /**
-     * @brief JSON file path
+     * @brief Get the number of bytes allocated by the document allocator
+     * 
+     * Reads never allocate in the document: this value only grows on load, 
+     * parse and write operations. The nodes parsed by the reads of a lazy
+     * loaded document have their own allocator, also counted.
+     * 
+     * @return size_t Processing result
      */
-    std::string m_strFilePath;
+    size_t allocated() const;
 
     /**
-     * @brief rapidjson document
+     * @brief Enable the hashed member index of wide objects
+     * 
+     * Objects with at least uiThreshold members get a side index mapping the
+     * hash of a member name to its slot. The indexes are built with the
+     * document (here, and by every load and set of the document) and kept
+     * valid by set() and remove(); lookups only read them, without lock.
+     * An object copied in as a whole is looked up by a scan until the
+     * document is reloaded.
+     * 
+     * @param uiThreshold Member count from which an object is indexed (0: disabled)
      */
-    ::rapidjson::Document m_docJsonFile;
+    void index(const uint32_t& uiThreshold);
 
     /**
-     * @brief rapid json document for child object
+     * @brief Select the parse front-end of load (STREAM) and set (copied data)
+     * 
+     * SIMD indexes the structural characters with AVX2 or SSE4.2 (scalar
+     * fallback, selected at run time, see scanner) and checks the text is
+     * valid UTF-8; it builds the same document as the rapidjson reader. The
+     * in situ parses (MMAP, moved data) keep the rapidjson reader.
+     * 
+     * @param eParser Parse front-end
      */
-    
-    ::rapidjson::Document m_childDocJsonFile;
+    void parser(const PARSER& eParser);
 
     /**
-     * @brief get the allocator of the json document
+     * @brief Set the parse options of load and set
+     * 
+     * Any non default option selects the rapidjson reader instead of the SIMD
+     * front-end. With the relaxed syntax, LOAD::LAZY loads as STREAM
+     * (the bracket index needs the strict structure).
+     * 
+     * @param parseConfig Parse options
      */
-    ::rapidjson::Document::AllocatorType& m_allocator = m_docJsonFile.GetAllocator();
+    void parser(const stParseConfig& parseConfig);
 
     /**
-     * @brief Node path separator
+     * @brief Compile a JSON node path
+     * 
+     * @param strNode JSON node path
+     * @return stPath Compiled JSON node path (empty if the path is invalid)
      */
-    const char m_cNodePathSeparator;
+    stPath compile(const std::string& strNode) const;
 
     /**
-     * @brief child object
+     * @brief Compile a nodes configuration
+     * 
+     * @param mapNodes Nodes map
+     * @return stSchema Compiled nodes configuration
      */
-    ::rapidjson::Value m_childObject;
+    stSchema compile(const std::map<std::string, stNodeConfig>& mapNodes) const;
 
     /**
-     * @brief Check node
+     * @brief Get JSON object value based its compiled path
      * 
-     * @param strNode JSON node path
-     * @param nodeConfig Node configuration 
-     * @param vecCheckRet Check result vector
+     * @param strValue Value to retrieve
+     * @param path Compiled JSON node path
      * @return int Processing result
      */
-    int check(const std::string& strNode, const stNodeConfig& nodeConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
+    int get(std::string& strValue, const stPath& path) const;
 
     /**
-     * @brief Get the elemnts of specific node
+     * @brief Get JSON object value based its compiled path, without copy
+     * 
+     * @param svValue Value to retrieve (valid until the next modification)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::string_view& svValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param iValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(int& iValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param ulValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(uint64_t& ulValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param uiValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(uint32_t& uiValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param usValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(uint16_t& usValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param ucValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(uint8_t& ucValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param lValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(int64_t& lValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param sValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(int16_t& sValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param cValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(int8_t& cValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * Any number is read, a finite number out of the float range fails (-2).
+     * 
+     * @param fValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(float& fValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param dValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(double& dValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param bValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(bool& bValue, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<std::string>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path, without copy
+     * 
+     * @param vecValues Value to retrieve (views valid until the next modification)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<std::string_view>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<uint64_t>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<uint32_t>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<uint16_t>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<uint8_t>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<int>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<int64_t>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<int16_t>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<int8_t>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<float>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<double>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @param vecValues Value to retrieve
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(std::vector<bool>& vecValues, const stPath& path) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its compiled path
+     * 
+     * @param pdValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(double* pdValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its compiled path
+     * 
+     * @param pfValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(float* pfValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its compiled path
+     * 
+     * @param pulValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(uint64_t* pulValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its compiled path
+     * 
+     * @param puiValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(uint32_t* puiValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its compiled path
+     * 
+     * @param pusValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(uint16_t* pusValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its compiled path
+     * 
+     * @param pucValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(uint8_t* pucValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its compiled path
+     * 
+     * @param piValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(int* piValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its compiled path
+     * 
+     * @param plValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(int64_t* plValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its compiled path
+     * 
+     * @param psValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(int16_t* psValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Get JSON array values into a contiguous buffer based its compiled path
+     * 
+     * @param pcValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out (required size on overflow)
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int get(int8_t* pcValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Get the type of specific node
+     * 
+     * @param path Compiled JSON node path
+     * @return TYPE type of the node
+     */
+    TYPE getType(const stPath& path) const;
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param pcValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const char* pcValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param strValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const std::string& strValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param iValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const int& iValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param ulValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const uint64_t& ulValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param uiValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const uint32_t& uiValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param usValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const uint16_t& usValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param ucValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const uint8_t& ucValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param lValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const int64_t& lValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param sValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const int16_t& sValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param cValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const int8_t& cValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param fValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const float& fValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param dValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const double& dValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param bValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int set(const bool& bValue, const stPath& path);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<std::string>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<uint64_t>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<uint32_t>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<uint16_t>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<uint8_t>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<int>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<int64_t>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<int16_t>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<int8_t>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<float>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<double>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @param vecValues Value to set
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int Processing result
+     */
+    int set(const std::vector<bool>& vecValues, const stPath& path, const SET_MODE& eMode = SET_MODE::REPLACE);
+
+    /**
+     * @brief remove JSON object value based its compiled path
+     * 
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    int remove(const stPath& path);
+
+    /**
+     * @brief Verify JSON object emty or not based its compiled path
+     * 
+     * @param path Compiled JSON node path
+     * @return bool Processing result
+     */
+    bool empty(const stPath& path) const;
+
+    /**
+     * @brief Verify JSON object exist or not based its compiled path
+     * 
+     * @param path Compiled JSON node path
+     * @return bool Processing result
+     */
+    bool exist(const stPath& path) const;
+
+    /**
+     * @brief Get the Size object
+     * 
+     * @param path Compiled JSON node path
+     * @return uint32_t Processing result
+     */
+    uint32_t size(const stPath& path) const;
+
+    /**
+     * @brief Check configuration
+     *
+     * @param strConfig Configuration string
+     * @param mapNodes Nodes map 
+     * @param vecCheckRet Check result vector
+     * @return int Processing result
+     */
+    int check(const std::string& strConfig, const std::map<std::string, stNodeConfig>& mapNodes, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
+
+    /**
+     * @brief Check configuration against a compiled schema
+     *
+     * @param strConfig Configuration string
+     * @param schema Compiled nodes configuration
+     * @param vecCheckRet Check result vector
+     * @return int Processing result
+     */
+    int check(const std::string& strConfig, const stSchema& schema, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
+
+    /**
+     * @brief Check the loaded configuration against a compiled schema
+     *
+     * @param schema Compiled nodes configuration
+     * @param vecCheckRet Check result vector
+     * @return int Processing result
+     */
+    int check(const stSchema& schema, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
+
+    /**
+     * @brief Check configuration with an execution configuration
+     *
+     * @param strConfig Configuration string
+     * @param mapNodes Nodes map 
+     * @param checkConfig Check execution configuration
+     * @param vecCheckRet Check result vector
+     * @return int Processing result
+     */
+    int check(const std::string& strConfig, const std::map<std::string, stNodeConfig>& mapNodes, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
+
+    /**
+     * @brief Check configuration against a compiled schema with an execution configuration
+     *
+     * @param strConfig Configuration string
+     * @param schema Compiled nodes configuration
+     * @param checkConfig Check execution configuration
+     * @param vecCheckRet Check result vector
+     * @return int Processing result
+     */
+    int check(const std::string& strConfig, const stSchema& schema, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
+
+    /**
+     * @brief Check the loaded configuration against a compiled schema with an execution configuration
+     *
+     * @param schema Compiled nodes configuration
+     * @param checkConfig Check execution configuration
+     * @param vecCheckRet Check result vector
+     * @return int Processing result
+     */
+    int check(const stSchema& schema, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
+    
+private:
+    /**
+     * @brief JSON file path
+     */
+    std::string m_strFilePath;
+
+    /**
+     * @brief rapidjson document
+     */
+    ::rapidjson::Document m_docJsonFile;
+
+    /**
+     * @brief get the allocator of the json document
+     */
+    ::rapidjson::Document::AllocatorType& m_allocator = m_docJsonFile.GetAllocator();
+
+    /**
+     * @brief Node path separator
+     */
+    const char m_cNodePathSeparator;
+
+    /**
+     * @brief Private file mapping referenced by the document (MMAP load)
+     */
+    void* m_pvMapping {nullptr};
+
+    /**
+     * @brief Size of the private file mapping
+     */
+    size_t m_ulMappingSize {0};
+
+    /**
+     * @brief In situ string data referenced by the document
+     */
+    std::unique_ptr<std::string> m_pstrBuffer;
+
+    /**
+     * @brief In situ data referenced by the document
+     */
+    std::vector<char> m_vecBuffer;
+
+    /**
+     * @brief Free an aligned buffer
+     */
+    struct stFree
+    {
+        void operator()(char* pcBuffer) const
+        {
+            std::free(pcBuffer);
+        }
+    };
+
+    /**
+     * @brief Write buffer, aligned and reused by the saves
+     */
+    std::unique_ptr<char, stFree> m_pcWriteBuffer;
+
+    /**
+     * @brief Output buffer of the json string views
+     */
+    ::rapidjson::StringBuffer m_jsonOutput;
+
+    /**
+     * @brief Output stream appending to a string
+     */
+    struct stStringStream;
+
+    /**
+     * @brief Output stream on a file descriptor
+     */
+    struct stFileStream;
+
+    /**
+     * @brief Member index of a wide object
+     */
+    struct stMemberIndex
+    {
+        const ::rapidjson::Value::Member*            pMembers {nullptr};
+        uint32_t                                     uiCount  {0};
+        std::unordered_multimap<uint32_t, uint32_t>  mapSlots;
+    };
+
+    /**
+     * @brief Member count from which an object is indexed (0: disabled)
+     */
+    uint32_t m_uiIndexThreshold {0};
+
+    /**
+     * @brief Read only phase (check): mutators fail
+     */
+    bool m_bReadOnly {false};
+
+    /**
+     * @brief Member indexes of the wide objects, by object address
+     * 
+     * Built with the document and updated by the writers, which have
+     * exclusive access: the readers look them up without lock.
+     */
+    mutable std::unordered_map<const ::rapidjson::Value*, stMemberIndex> m_mapIndexes;
+
+    /**
+     * @brief Parse front-end of load and set
+     */
+    PARSER m_eParser {PARSER::READER};
+
+    /**
+     * @brief rapidjson parse flags of load and set (see stParseConfig)
+     */
+    unsigned m_uiParseFlags {::rapidjson::kParseDefaultFlags};
+
+    /**
+     * @brief SIMD parse front-end, kept for its buffers
+     */
+    std::unique_ptr<scanner> m_pScanner;
+
+    /**
+     * @brief Raw text, brackets index and parsed nodes of a lazy load
+     */
+    struct stLazy;
+
+    /**
+     * @brief Lazy load state (nullptr if the document is parsed)
+     */
+    mutable std::unique_ptr<stLazy> m_pLazy;
+
+    /**
+     * @brief The document is not parsed yet (lazy load)
+     */
+    mutable std::atomic<bool> m_bLazy {false};
+
+    /**
+     * @brief Lazy reads (shared) against the node and document parses (exclusive)
+     */
+    mutable std::shared_mutex m_mutexLazy;
+
+    /**
+     * @brief Serialize a JSON node to an output stream
      * 
-     * @param strNode JSON node path 
-     * @return std::vector<std::string> vector of elements names
+     * @tparam tStream Output stream type
+     * @param stream Output stream
+     * @param jsonValue JSON node
+     * @param format Output format
+     * @return bool Processing result
      */
-    std::vector<std::string> getElements(const std::string& strNode);
+    template<typename tStream>
+    inline bool serialize(tStream& stream, const ::rapidjson::Value& jsonValue, const stFormat& format) const;
 
     /**
-     * @brief Set JSON object value based its path
+     * @brief Serialize a JSON node to an output stream with given write flags
      * 
-     * @tparam T_VALUE 
-     * @param jsonObject JSON object
-     * @param tValue Value to retrieve
-     * @param strNode JSON node path
+     * @tparam uiWriteFlags rapidjson write flags
+     * @tparam tStream Output stream type
+     * @param stream Output stream
+     * @param jsonValue JSON node
+     * @param format Output format
+     * @return bool Processing result
+     */
+    template<unsigned uiWriteFlags, typename tStream>
+    static inline bool serialize(tStream& stream, const ::rapidjson::Value& jsonValue, const stFormat& format);
+
+    /**
+     * @brief Call a parse with the parse flags of this object as template argument
+     * 
+     * The parse is called with std::integral_constant<unsigned, flags> for one
+     * of the four flag combinations of stParseConfig.
+     * 
+     * @tparam tParse Parse type
+     * @param parse Parse, returning its processing result
+     * @return bool Processing result of the parse
+     */
+    template<typename tParse>
+    inline bool dispatch(tParse&& parse) const;
+
+    /**
+     * @brief Write a JSON node to a file descriptor
+     * 
+     * @param iFile File descriptor
+     * @param jsonValue JSON node
+     * @param format Output format
      * @return int Processing result
      */
-    template<typename T_VALUE>
-    inline int set(::rapidjson::Value& jsonObject, const T_VALUE& tValue, const std::string& strNode);
+    inline int output(const int& iFile, const ::rapidjson::Value& jsonValue, const stFormat& format);
 
     /**
-     * @brief processing of JSON object value based its path
+     * @brief Write a JSON node to a file
      * 
-     * @tparam T_VALUE 
-     * @param jsonObject object of the json file
-     * @param tValue Value to retrieve
-     * @param strNode JSON node path
-     * @param eType Type of the process
-     * @return int rocessing result
+     * @param pFile File
+     * @param jsonValue JSON node
+     * @param format Output format
+     * @return int Processing result
      */
-    template<typename T_VALUE>
-    inline int process(::rapidjson::Value& jsonObject, T_VALUE& tValue, const std::string& strNode, const stProcess::TYPE& eType);
+    inline int output(FILE* pFile, const ::rapidjson::Value& jsonValue, const stFormat& format);
 
     /**
-     * @brief processing of JSON object value based its path
+     * @brief Write buffer of an output (own buffer while read only)
      * 
-     * @param jsonObject object of the json file
-     * @param strNode JSON node path
-     * @return JSON_TYPE type of node
+     * @param pcLocalBuffer Buffer of the output, used while read only
+     * @return char* Write buffer (nullptr if it can not be allocated)
+     */
+    inline char* buffer(std::unique_ptr<char, stFree>& pcLocalBuffer);
+
+    /**
+     * @brief Flush a written file to the disk
+     * 
+     * @param iFile File descriptor
+     * @param eSync Synchronization mode
+     * @return int Processing result
+     */
+    static inline int flush(const int& iFile, const stSaveConfig::SYNC& eSync);
+
+    /**
+     * @brief Check a resolved node and its children in a single pass
+     * 
+     * @param pNode JSON node (nullptr if it does not exist)
+     * @param strPath JSON node path, used as buffer for the children paths
+     * @param schema Compiled nodes configuration
+     * @param rule Rule of the node
+     * @param checkConfig Check execution configuration
+     * @param vecCheckRet Check result vector
+     * @return int Processing result
+     */
+    inline int check(::rapidjson::Value* pNode, std::string& strPath, const stSchema& schema, const stSchema::stRule& rule, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
+
+    /**
+     * @brief Check the children of an object node
+     * 
+     * @param jsonObject JSON object node
+     * @param strPath JSON node path, used as buffer for the children paths
+     * @param schema Compiled nodes configuration
+     * @param uiFirst First rule of the children
+     * @param uiCount Number of children rules
+     * @param checkConfig Check execution configuration
+     * @param vecCheckRet Check result vector
+     * @return int Processing result
+     */
+    inline int check(::rapidjson::Value& jsonObject, std::string& strPath, const stSchema& schema, const uint32_t& uiFirst, const uint32_t& uiCount, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
+
+    /**
+     * @brief Check a range of the items of an array of objects
+     * 
+     * @param jsonArray JSON array node
+     * @param strPath JSON array path, used as buffer for the items paths
+     * @param schema Compiled nodes configuration
+     * @param rule Rule of the array
+     * @param uiBegin First item
+     * @param uiEnd Item after the last one
+     * @param checkConfig Check execution configuration
+     * @param vecCheckRet Check result vector
+     * @param pErrors Error count shared by the parallel workers (nullptr: serial check)
+     * @return int Processing result
+     */
+    inline int check(::rapidjson::Value& jsonArray, std::string& strPath, const stSchema& schema, const stSchema::stRule& rule, const ::rapidjson::SizeType& uiBegin, const ::rapidjson::SizeType& uiEnd, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet, std::atomic<size_t>* pErrors);
+
+    /**
+     * @brief SAX handler validating a compiled schema while parsing
+     */
+    struct stSaxHandler;
+
+    /**
+     * @brief Validate a configuration string against a compiled schema while parsing it
+     * 
+     * @param strConfig Configuration string
+     * @param schema Compiled nodes configuration
+     * @param vecCheckRet Check result vector (first violation)
+     * @return int Processing result
+     */
+    inline int stream(const std::string& strConfig, const stSchema& schema, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet);
+
+    /**
+     * @brief Maximum number of errors of a check (0: no limit)
+     * 
+     * @param checkConfig Check execution configuration
+     * @return size_t Processing result
+     */
+    static inline size_t limit(const stCheckConfig& checkConfig);
+
+    /**
+     * @brief Get the elemnts of specific node
+     * 
+     * @param strNode JSON node path 
+     * @return std::vector<std::string> vector of elements names
      */
-    inline TYPE process(::rapidjson::Value& jsonObject, const std::string& strNode);
+    std::vector<std::string> getElements(const std::string& strNode) const;
 
     /**
      * @brief Get the type of a specific node
@@ -761,7 +2166,7 @@ private:
      * @param jsonObject object of the json file
      * @return JSON_TYPE type of node
      */
-    inline TYPE type(::rapidjson::Value& jsonObject);
+    inline TYPE type(const ::rapidjson::Value& jsonObject) const;
 
     /**
      * @brief Get the elemnt of a specific type
@@ -771,16 +2176,7 @@ private:
      * @return int rocessing result
      */
     template<typename T_VALUE>
-    inline int element(::rapidjson::Value& jsonObject, T_VALUE& tValue);
-
-    /**
-     * @brief processing of JSON object value based its path
-     * 
-     * @param jsonObject object of the json file
-     * @param strNode JSON node path
-     * @return std::vector<std::string> list of elemnts
-     */
-    inline std::vector<std::string> processList(::rapidjson::Value& jsonObject, const std::string& strNode);
+    inline int element(const ::rapidjson::Value& jsonObject, T_VALUE& tValue) const;
 
     /**
      * @brief get JSON object value based its path
@@ -802,15 +2198,6 @@ private:
      */
     inline int remove(::rapidjson::Value& jsonObject, const std::string& strNode);
 
-    /**
-     * @brief Get the Size object
-     * 
-     * @param jsonObject object of the json file
-     * @param strNode Value to retrieve
-     * @return uint32_t processing result
-     */
-    inline uint32_t size(::rapidjson::Value& jsonObject, const std::string& strNode);
-
     /**
      * @brief Cast data 
      * 
@@ -825,51 +2212,321 @@ private:
     inline int castData(::rapidjson::Value& memberName , const T_TYPEA& tType, ::rapidjson::Value& jsonObject, const stProcess::TYPE& eType);
     
     /**
-     * @brief Get the Element object
+     * @brief Get the vector of elements 
      * 
      * @tparam T_VALUE 
-     * @param tValue data value
-     * @param jsonObject json array 
-     * @param uiArrayElemnt the number of the array element
+     * @param vecValue data value
+     * @param strNode path of the node
      * @return int processing result
      */
     template<typename T_VALUE>
-    inline int getElement(T_VALUE& tValue, ::rapidjson::Value& jsonObject, const uint64_t& uiArrayElemnt);
+    inline int getVector(std::vector<T_VALUE>& vecValue, const std::string& strNode) const;
 
     /**
-     * @brief Set the Element object
+     * @brief Set the vector of elements 
      * 
      * @tparam T_VALUE 
-     * @param tValue data value
-     * @param jsonObject json array 
-     * @param uiArrayElemnt the number of the array element
-     * @param eType type of process
+     * @param vecValue data value
+     * @param strNode path of the node
+     * @param eMode Array write mode
+     * @return int processing result
+     */
+    template<typename T_VALUE>
+    inline int setVector(const std::vector<T_VALUE>& vecValue, const std::string& strNode, const SET_MODE& eMode);
+
+    /**
+     * @brief Set JSON object value based its compiled path
+     * 
+     * @tparam T_VALUE 
+     * @param jsonObject JSON object
+     * @param tValue Value to set
+     * @param path Compiled JSON node path
+     * @return int Processing result
+     */
+    template<typename T_VALUE>
+    inline int set(::rapidjson::Value& jsonObject, const T_VALUE& tValue, const stPath& path);
+
+    /**
+     * @brief processing of JSON object value based its compiled path
+     * 
+     * @tparam T_VALUE 
+     * @param jsonObject object of the json file
+     * @param tValue Value to retrieve
+     * @param path Compiled JSON node path
+     * @param eType Type of the process
      * @return int processing result
      */
     template<typename T_VALUE>
-    inline int setElement(::rapidjson::Value& memberName , const T_VALUE& tValue, ::rapidjson::Value& jsonObject, const stProcess::TYPE& eType, const stProcess::TYPE& eDataType);
+    inline int process(::rapidjson::Value& jsonObject, T_VALUE& tValue, const stPath& path, const stProcess::TYPE& eType);
 
     /**
      * @brief Get the vector of elements 
      * 
      * @tparam T_VALUE 
      * @param vecValue data value
-     * @param strNode path of the node
+     * @param path Compiled JSON node path
+     * @return int processing result
+     */
+    template<typename T_VALUE>
+    inline int getVector(std::vector<T_VALUE>& vecValue, const stPath& path) const;
+
+    /**
+     * @brief Get the array elements into a contiguous buffer
+     * 
+     * @tparam T_VALUE 
+     * @param ptValues Buffer of the values
+     * @param ulSize Buffer size in, number of values out
+     * @param path Compiled JSON node path
+     * @return int processing result
+     */
+    template<typename T_VALUE>
+    inline int getBuffer(T_VALUE* ptValues, size_t& ulSize, const stPath& path) const;
+
+    /**
+     * @brief Convert numeric array elements into a contiguous buffer
+     * 
+     * @tparam T_VALUE 
+     * @param pElements Array elements
+     * @param ulCount Number of elements
+     * @param ptValues Buffer of the values
      * @return int processing result
      */
     template<typename T_VALUE>
-    inline int getVector(std::vector<T_VALUE>& vecValue, const std::string& strNode);
+    static inline int convert(const ::rapidjson::Value* pElements, const size_t& ulCount, T_VALUE* ptValues);
 
     /**
      * @brief Set the vector of elements 
      * 
      * @tparam T_VALUE 
      * @param vecValue data value
-     * @param strNode path of the node
+     * @param path Compiled JSON node path
+     * @param eMode Array write mode
+     * @return int processing result
+     */
+    template<typename T_VALUE>
+    inline int setVector(const std::vector<T_VALUE>& vecValue, const stPath& path, const SET_MODE& eMode);
+
+    /**
+     * @brief Find the child of an object based on a path segment
+     * 
+     * @param jsonObject object of the json file
+     * @param segment Compiled path segment
+     * @return ::rapidjson::Value* Child node (nullptr if not found)
+     */
+    inline ::rapidjson::Value* find(::rapidjson::Value& jsonObject, const stPath::stSegment& segment);
+
+    /**
+     * @brief Find the child of an object based on a path segment
+     * 
+     * @param jsonObject object of the json file
+     * @param segment Compiled path segment
+     * @return const ::rapidjson::Value* Child node (nullptr if not found)
+     */
+    inline const ::rapidjson::Value* find(const ::rapidjson::Value& jsonObject, const stPath::stSegment& segment) const;
+
+    /**
+     * @brief Find the member of an object based on its precomputed name hash
+     * 
+     * @param jsonObject object of the json file
+     * @param pcName member name
+     * @param ulLength member name length
+     * @param uiHash member name hash
+     * @return ::rapidjson::Value::MemberIterator Member (MemberEnd() if not found)
+     */
+    inline ::rapidjson::Value::MemberIterator member(::rapidjson::Value& jsonObject, const char* pcName, const size_t& ulLength, const uint32_t& uiHash);
+
+    /**
+     * @brief Find the member of an object based on its precomputed name hash
+     * 
+     * @param jsonObject object of the json file
+     * @param pcName member name
+     * @param ulLength member name length
+     * @param uiHash member name hash
+     * @return ::rapidjson::Value::ConstMemberIterator Member (MemberEnd() if not found)
+     */
+    inline ::rapidjson::Value::ConstMemberIterator member(const ::rapidjson::Value& jsonObject, const char* pcName, const size_t& ulLength, const uint32_t& uiHash) const;
+
+    /**
+     * @brief Get the member index of an object
+     * 
+     * @param jsonObject object of the json file
+     * @return const stMemberIndex* Member index (nullptr if not indexed or not valid)
+     */
+    inline const stMemberIndex* indexGet(const ::rapidjson::Value& jsonObject) const;
+
+    /**
+     * @brief Build the member index of an object
+     * 
+     * @param jsonObject object of the json file
+     */
+    inline void indexMake(const ::rapidjson::Value& jsonObject) const;
+
+    /**
+     * @brief Build the member indexes of the document (document reloaded)
+     */
+    inline void indexBuild() const;
+
+    /**
+     * @brief Update the member index of an object after a member was added
+     * 
+     * @param jsonObject object of the json file
+     */
+    inline void indexAdd(::rapidjson::Value& jsonObject);
+
+    /**
+     * @brief Update the member index of an object before a member is removed
+     * 
+     * @param jsonObject object of the json file
+     * @param itMember Member to remove
+     */
+    inline void indexRemove(::rapidjson::Value& jsonObject, const ::rapidjson::Value::MemberIterator& itMember);
+
+    /**
+     * @brief Get the node of a resolved member
+     * 
+     * @param jsonObject object of the json file
+     * @param itMember Member of the object
+     * @param ulArrayElemnt the number of the array element
+     * @return ::rapidjson::Value* Node (nullptr if not found)
+     */
+    inline ::rapidjson::Value* find(::rapidjson::Value& jsonObject, const ::rapidjson::Value::MemberIterator& itMember, const uint64_t& ulArrayElemnt);
+
+    /**
+     * @brief Get the node of a resolved member
+     * 
+     * @param jsonObject object of the json file
+     * @param itMember Member of the object
+     * @param ulArrayElemnt the number of the array element
+     * @return const ::rapidjson::Value* Node (nullptr if not found)
+     */
+    inline const ::rapidjson::Value* find(const ::rapidjson::Value& jsonObject, const ::rapidjson::Value::ConstMemberIterator& itMember, const uint64_t& ulArrayElemnt) const;
+
+    /**
+     * @brief Find a node based its compiled path
+     * 
+     * @param jsonObject object of the json file
+     * @param path Compiled JSON node path
+     * @return ::rapidjson::Value* Node (nullptr if not found)
+     */
+    inline ::rapidjson::Value* find(::rapidjson::Value& jsonObject, const stPath& path);
+
+    /**
+     * @brief Find a node based its compiled path
+     * 
+     * @param jsonObject object of the json file
+     * @param path Compiled JSON node path
+     * @return const ::rapidjson::Value* Node (nullptr if not found)
+     */
+    inline const ::rapidjson::Value* find(const ::rapidjson::Value& jsonObject, const stPath& path) const;
+
+    /**
+     * @brief Get JSON object value based its compiled path
+     * 
+     * @tparam T_VALUE 
+     * @param tValue Value to retrieve
+     * @param path Compiled JSON node path
      * @return int processing result
      */
     template<typename T_VALUE>
-    inline int setVector(const std::vector<T_VALUE>& vecValue, const std::string& strNode);
+    inline int getValue(T_VALUE& tValue, const stPath& path) const;
+
+    /**
+     * @brief Find a node based its compiled path, create the missing nodes
+     * 
+     * @param jsonObject object of the json file
+     * @param path Compiled JSON node path
+     * @return ::rapidjson::Value* Node (nullptr if it can not be created)
+     */
+    inline ::rapidjson::Value* create(::rapidjson::Value& jsonObject, const stPath& path);
+
+    /**
+     * @brief Hash a node name
+     * 
+     * @param pcName node name
+     * @param ulLength node name length
+     * @return uint32_t hash of the name
+     */
+    static inline uint32_t hash(const char* pcName, const size_t& ulLength);
+
+    /**
+     * @brief Map and parse the json file in situ
+     * 
+     * @param strFile JSON file path
+     * @return int processing result
+     */
+    inline int map(const std::string& strFile);
+
+    /**
+     * @brief Release the buffers referenced by the document (mapping, in situ data)
+     */
+    inline void release();
+
+    /**
+     * @brief Parse json data with the SIMD front-end
+     * 
+     * @param pcData JSON data
+     * @param ulSize JSON data length
+     * @return int processing result
+     */
+    inline int scan(const char* pcData, const size_t& ulSize);
+
+    /**
+     * @brief Parse the json file with the SIMD front-end
+     * 
+     * @param strFile JSON file path
+     * @return int processing result
+     */
+    inline int scan(const std::string& strFile);
+
+    /**
+     * @brief Map the json file and index its brackets (lazy load)
+     * 
+     * The values are validated when they are parsed: by the node reads, or
+     * by the first read or write of the whole document.
+     * 
+     * @param strFile JSON file path
+     * @return int processing result
+     */
+    inline int lazy(const std::string& strFile);
+
+    /**
+     * @brief Get the document, parsed first if it is lazy loaded
+     * 
+     * @return ::rapidjson::Document& Processing result
+     */
+    inline ::rapidjson::Document& document();
+
+    /**
+     * @brief Get the document, parsed first if it is lazy loaded
+     * 
+     * @return const ::rapidjson::Document& Processing result
+     */
+    inline const ::rapidjson::Document& document() const;
+
+    /**
+     * @brief Parse the whole lazy loaded document
+     * 
+     * @return int Processing result (-1 if the lazy loaded text is malformed)
+     */
+    inline int materialize() const;
+
+    /**
+     * @brief Get the number of bytes allocated for the lazy nodes
+     * 
+     * @return size_t Processing result
+     */
+    inline size_t lazyAllocated() const;
+
+    /**
+     * @brief Find a node to read based its compiled path
+     * 
+     * A lazy loaded document is not parsed: the node is located in the raw
+     * text and only its value is parsed (and cached).
+     * 
+     * @param path Compiled JSON node path
+     * @return const ::rapidjson::Value* Node (nullptr if not found)
+     */
+    inline const ::rapidjson::Value* node(const stPath& path) const;
 
     /**
      * @brief Split a given path
@@ -880,7 +2537,7 @@ private:
      * @param uiArrayElemnt array number
      * @return int processing result
      */
-    inline int split(const std::string& strPath, std::string& strNode, std::string& strChildren, uint64_t& uiArrayElemnt);
+    inline int split(const std::string& strPath, std::string& strNode, std::string& strChildren, uint64_t& uiArrayElemnt) const;
 };
 
 
@@ -0,0 +1,191 @@
+/**
+ * @file scanner.hpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief SIMD structural scanner parse front-end
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+
+#ifndef _UTILITIES_SCANNER_HPP_
+#define _UTILITIES_SCANNER_HPP_
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "document.h"
+#include "reader.h"
+
+namespace utilities {
+
+
+/**
+ * @brief Parse front-end indexing the structural characters with SIMD
+ * 
+ * The text is first checked to be valid UTF-8, then classified by blocks of
+ * 64 bytes (AVX2, SSE4.2 or scalar, selected at run time) into the offsets
+ * of its structural characters: brackets, colons and commas outside the
+ * strings, string quotes and scalar starts. The document is then populated
+ * from these offsets; scalars are converted by the rapidjson reader so the
+ * document is the same as the one parsed by rapidjson.
+ * The buffers are kept between parses.
+ */
+class scanner
+{
+public:
+    /**
+     * @brief Construct a new scanner object
+     */
+    scanner();
+
+    /**
+     * @brief Destroy the scanner object
+     */
+    virtual ~scanner();
+
+    /**
+     * @brief Parse a json text into a document (unchanged on failure)
+     * 
+     * @param docJson JSON document
+     * @param pcData JSON text
+     * @param ulSize JSON text length (less than 4 GB)
+     * @return int Processing result
+     */
+    int parse(::rapidjson::Document& docJson, const char* pcData, const size_t& ulSize);
+
+    /**
+     * @brief Index the matching brackets of a json text, without parsing it
+     * 
+     * The text is checked to be valid UTF-8 and its strings to be terminated
+     * without control characters; the values themselves are not validated.
+     * 
+     * @param pcData JSON text
+     * @param ulSize JSON text length (less than 4 GB)
+     * @param vecOpen Offsets of the opening brackets, in text order
+     * @param vecClose Offsets of the matching closing brackets
+     * @return int Processing result
+     */
+    int brackets(const char* pcData, const size_t& ulSize, std::vector<uint64_t>& vecOpen, std::vector<uint64_t>& vecClose);
+
+    /**
+     * @brief Get the name of the kernel in use
+     * 
+     * @return const char* Processing result ("avx2", "sse4.2" or "scalar")
+     */
+    static const char* kernel();
+
+    /**
+     * @brief Force the kernel of every scanner (tests and benchmarks)
+     * 
+     * Not to be called while a scanner parses.
+     * 
+     * @param strKernel Kernel name ("avx2", "sse4.2" or "scalar")
+     * @return int Processing result (-1 if this CPU does not support it)
+     */
+    static int kernel(const std::string& strKernel);
+
+    /**
+     * @brief Get the names of the kernels supported by this CPU, best first
+     * 
+     * @return std::vector<std::string> Processing result
+     */
+    static std::vector<std::string> kernels();
+
+private:
+    /**
+     * @brief Check that a text is valid UTF-8
+     * 
+     * @param pcData Text
+     * @param ulSize Text length
+     * @return int Processing result
+     */
+    static int utf8(const char* pcData, const size_t& ulSize);
+
+    /**
+     * @brief Index the structural characters of the text
+     * 
+     * @param bBrackets Index the brackets only
+     * @return int Processing result
+     */
+    int index(const bool& bBrackets);
+
+    /**
+     * @brief Emit the values of the scanned text (generator of Document::Populate)
+     * 
+     * @param docHandler Document handler
+     * @return bool Processing result
+     */
+    bool emit(::rapidjson::Document& docHandler);
+
+    /**
+     * @brief Emit a string
+     * 
+     * @param docHandler Document handler
+     * @param ulBegin Offset of the opening quote
+     * @param ulEnd Offset of the closing quote
+     * @param bKey The string is a member name
+     * @return bool Processing result
+     */
+    bool string(::rapidjson::Document& docHandler, const uint64_t& ulBegin, const uint64_t& ulEnd, const bool& bKey);
+
+    /**
+     * @brief Emit a scalar (number, true, false or null)
+     * 
+     * @param docHandler Document handler
+     * @param ulBegin Offset of the scalar
+     * @return bool Processing result
+     */
+    bool scalar(::rapidjson::Document& docHandler, const uint64_t& ulBegin);
+
+    /**
+     * @brief Container being emitted
+     */
+    struct stFrame
+    {
+        bool                    bObject {false};
+        ::rapidjson::SizeType   uiCount {0};
+    };
+
+    /**
+     * @brief Scalar handler forwarding to the document
+     */
+    struct stScalar;
+
+    /**
+     * @brief Scanned text
+     */
+    const char* m_pcData {nullptr};
+
+    /**
+     * @brief Scanned text length
+     */
+    size_t m_ulSize {0};
+
+    /**
+     * @brief Offsets of the structural characters
+     */
+    std::vector<uint32_t> m_vecStructurals;
+
+    /**
+     * @brief Containers being emitted
+     */
+    std::vector<stFrame> m_vecFrames;
+
+    /**
+     * @brief Unescaped string buffer
+     */
+    std::string m_strBuffer;
+
+    /**
+     * @brief Scalar reader
+     */
+    ::rapidjson::Reader m_reader;
+};
+
+
+} // namespace utilities
+
+#endif //_UTILITIES_SCANNER_HPP_
@@ -0,0 +1,164 @@
+/**
+ * @file watcher.hpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief rapidjson file watcher
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+
+#ifndef _UTILITIES_WATCHER_HPP_
+#define _UTILITIES_WATCHER_HPP_
+
+
+#include <chrono>
+#include "holder.hpp"
+
+namespace utilities {
+
+
+/**
+ * @brief Watcher reloading the json file of a holder when it changes
+ * 
+ * The directory of the file is watched with inotify, so both in-place writes
+ * and atomic rename-replace are seen. Bursts of events are debounced, then the
+ * file is loaded and checked against the registered schema on the watcher
+ * thread; the new snapshot is published only when it is valid. Each reloaded
+ * snapshot gets the snapshot options of the holder (parse options, parse
+ * front-end, member index threshold).
+ */
+class watcher
+{
+public:
+    /**
+     * @brief Reload result callback (called on the watcher thread)
+     */
+    typedef std::function<void(const int& iRet, const std::vector<std::pair<std::string, rapidjson::CHECK_ERROR>>& vecCheckRet)> tCallback;
+
+    /**
+     * @brief Construct a new watcher object
+     * 
+     * @param holderRef Snapshots holder, its current snapshot path is watched
+     * @param uiDebounce Debounce delay in milliseconds
+     * @param eLoad File load mode
+     * @param callback Reload result callback
+     */
+    watcher(holder& holderRef, const uint32_t& uiDebounce = 100, const rapidjson::LOAD& eLoad = rapidjson::LOAD::STREAM, const tCallback& callback = nullptr);
+
+    /**
+     * @brief Destroy the watcher object
+     */
+    virtual ~watcher();
+
+    watcher(const watcher&) = delete;
+    watcher& operator=(const watcher&) = delete;
+
+    /**
+     * @brief Register the schema the reloaded file is checked against
+     * 
+     * @param mapNodes Nodes map 
+     * @return int Processing result
+     */
+    int schema(const std::map<std::string, rapidjson::stNodeConfig>& mapNodes);
+
+    /**
+     * @brief Start watching
+     * 
+     * @return int Processing result
+     */
+    int start();
+
+    /**
+     * @brief Stop watching, the watcher thread is always joined
+     * 
+     * @return int Processing result
+     */
+    int stop();
+
+    /**
+     * @brief Reload the json file now
+     * 
+     * @return int Processing result
+     */
+    int reload();
+
+private:
+    /**
+     * @brief Watcher thread loop
+     */
+    void run();
+
+    /**
+     * @brief Read the pending inotify events
+     * 
+     * @return bool Processing result (The watched file changed)
+     */
+    bool events();
+
+    /**
+     * @brief Release the watcher descriptors
+     */
+    void release();
+
+    /**
+     * @brief Snapshots holder
+     */
+    holder& m_holder;
+
+    /**
+     * @brief Debounce delay
+     */
+    const std::chrono::milliseconds m_debounce;
+
+    /**
+     * @brief File load mode
+     */
+    const rapidjson::LOAD m_eLoad;
+
+    /**
+     * @brief Reload result callback
+     */
+    const tCallback m_callback;
+
+    /**
+     * @brief Watched file name, in its directory
+     */
+    std::string m_strFileName;
+
+    /**
+     * @brief Registered schema
+     */
+    std::shared_ptr<const rapidjson::stSchema> m_pSchema;
+
+    /**
+     * @brief Protect the registered schema
+     */
+    std::mutex m_mutexSchema;
+
+    /**
+     * @brief inotify descriptor
+     */
+    int m_iNotify {-1};
+
+    /**
+     * @brief Stop event descriptor
+     */
+    int m_iStop {-1};
+
+    /**
+     * @brief Stop request, checked by the watcher thread at each poll
+     */
+    std::atomic<bool> m_bStop {false};
+
+    /**
+     * @brief Watcher thread
+     */
+    std::thread m_thread;
+};
+
+
+} // namespace utilities
+
+#endif //_UTILITIES_WATCHER_HPP_
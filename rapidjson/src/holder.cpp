@@ -0,0 +1,229 @@
+/**
+ * @file holder.cpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief rapidjson snapshots holder
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+
+#include "holder.hpp"
+
+
+namespace utilities {
+
+
+/**
+ * @brief Pin the current snapshot
+ * 
+ * The pin registers in the counter of the current epoch, then checks that the
+ * epoch did not flip meanwhile: a writer waiting for this counter may have
+ * missed the registration, so the reader retries on the new epoch.
+ * 
+ * @param holderRef Snapshots holder
+ */
+holder::reader::reader(holder& holderRef):
+    m_holder{holderRef}
+{
+    bool bPinned = false;
+
+    while(!bPinned)
+    {
+        uint32_t uiEpoch = m_holder.m_uiEpoch.load();
+        m_uiCounter = uiEpoch & 1;
+        m_holder.m_auiReaders[m_uiCounter].fetch_add(1);
+        bPinned = (m_holder.m_uiEpoch.load() == uiEpoch);
+        if(!bPinned)
+        {   // Epoch flipped meanwhile: retry on the new epoch
+            m_holder.m_auiReaders[m_uiCounter].fetch_sub(1);
+        }
+    }
+    m_pJson = m_holder.m_pSnapshot.load();
+}
+
+/**
+ * @brief Release the pinned snapshot
+ */
+holder::reader::~reader()
+{
+    m_holder.m_auiReaders[m_uiCounter].fetch_sub(1);
+}
+
+/**
+ * @brief Get the pinned snapshot
+ * 
+ * @return const rapidjson& Processing result
+ */
+const rapidjson& holder::reader::json() const
+{
+    return *m_pJson;
+}
+
+/**
+ * @brief Access the pinned snapshot
+ * 
+ * @return const rapidjson* Processing result
+ */
+const rapidjson* holder::reader::operator->() const
+{
+    return m_pJson;
+}
+
+/**
+ * @brief Construct a new holder object, with an empty snapshot
+ * 
+ * @param strFilePath JSON file path
+ * @param cNodePathSeparator Node path separator
+ */
+holder::holder(const std::string& strFilePath, const char& cNodePathSeparator):
+    holder(strFilePath, cNodePathSeparator, stSnapshotConfig())
+{
+}
+
+/**
+ * @brief Construct a new holder object, with an empty snapshot and snapshot options
+ * 
+ * @param strFilePath JSON file path
+ * @param cNodePathSeparator Node path separator
+ * @param snapshotConfig Options applied to every new snapshot
+ */
+holder::holder(const std::string& strFilePath, const char& cNodePathSeparator, const stSnapshotConfig& snapshotConfig):
+    m_strFilePath       {strFilePath},
+    m_cNodePathSeparator{cNodePathSeparator},
+    m_snapshotConfig    {snapshotConfig}
+{
+    m_auiReaders[0] = 0;
+    m_auiReaders[1] = 0;
+    m_pSnapshot = create(m_strFilePath).release();
+}
+
+/**
+ * @brief Destroy the holder object (no reader may be alive)
+ */
+holder::~holder()
+{
+    delete m_pSnapshot.load();
+}
+
+/**
+ * @brief Pin the current snapshot
+ * 
+ * @return holder::reader Processing result
+ */
+holder::reader holder::read()
+{
+    return reader(*this);
+}
+
+/**
+ * @brief Load the json file into a new snapshot and publish it
+ * 
+ * The current snapshot is kept when the load fails.
+ * 
+ * @param strFilePath JSON file path
+ * @param eLoad File load mode
+ * @return int Processing result
+ */
+int holder::load(const std::string& strFilePath, const rapidjson::LOAD& eLoad)
+{
+    std::unique_ptr<rapidjson> pJson = create(strFilePath.empty()? m_strFilePath: strFilePath);
+    int                        iRet = pJson->load("", eLoad);
+
+    if(!iRet)
+    {
+        iRet = publish(std::move(pJson));
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Load the json file into a new snapshot, check it and publish it
+ * 
+ * The current snapshot is kept when the load or the check fails.
+ * 
+ * @param schema Compiled nodes configuration
+ * @param vecCheckRet Check result vector
+ * @param strFilePath JSON file path
+ * @param eLoad File load mode
+ * @return int Processing result
+ */
+int holder::load(const rapidjson::stSchema& schema, std::vector<std::pair<std::string, rapidjson::CHECK_ERROR>>& vecCheckRet, const std::string& strFilePath, const rapidjson::LOAD& eLoad)
+{
+    std::unique_ptr<rapidjson> pJson = create(strFilePath.empty()? m_strFilePath: strFilePath);
+    int                        iRet = 0;
+    // Initialization
+    vecCheckRet.clear();
+
+    iRet = pJson->load("", eLoad);
+    if(!iRet)
+    {
+        iRet = pJson->check(schema, vecCheckRet);
+    }
+    if(!iRet)
+    {
+        iRet = publish(std::move(pJson));
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Publish a snapshot, free the previous one once its readers are done
+ * 
+ * The snapshot is swapped before the epoch flips, so the readers registered on
+ * the new epoch only see the new snapshot; the previous one is freed once the
+ * counter of the old epoch drains.
+ * 
+ * @param pJson New snapshot
+ * @return int Processing result
+ */
+int holder::publish(std::unique_ptr<rapidjson>&& pJson)
+{
+    int iRet = 0;
+
+    if(!pJson)
+    {
+        iRet = -1;
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lockWriter(m_mutexWriter);
+        rapidjson* pOld    = m_pSnapshot.exchange(pJson.release());
+        uint32_t   uiEpoch = m_uiEpoch.fetch_add(1);
+        // Wait for the readers of the old epoch
+        while(m_auiReaders[uiEpoch & 1].load() != 0)
+        {
+            std::this_thread::yield();
+        }
+        delete pOld;
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Create a new snapshot with the snapshot options
+ * 
+ * @param strFilePath JSON file path
+ * @return std::unique_ptr<rapidjson> Processing result
+ */
+std::unique_ptr<rapidjson> holder::create(const std::string& strFilePath) const
+{
+    std::unique_ptr<rapidjson> pJson(new rapidjson(strFilePath, m_cNodePathSeparator));
+
+    pJson->parser(m_snapshotConfig.parseConfig);
+    pJson->parser(m_snapshotConfig.eParser);
+    pJson->index(m_snapshotConfig.uiIndex);
+
+    // Return processing result
+    return pJson;
+}
+
+
+} // namespace utilities
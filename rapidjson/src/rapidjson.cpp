@@ -17,8 +17,13 @@
 namespace utilities {
 
 
-#define IS_OBJECT        UINT64_MAX
-#define FILE_BUFFER_SIZE 128 * 1024
+#define IS_OBJECT          UINT64_MAX
+#define FILE_BUFFER_SIZE   128 * 1024
+#define CONVERT_BLOCK_SIZE 256
+#define SAVE_BUFFER_SIZE   1024 * 1024
+#define SAVE_BUFFER_ALIGN  4096
+#define PARSE_RELAXED      (::rapidjson::kParseCommentsFlag | ::rapidjson::kParseTrailingCommasFlag | ::rapidjson::kParseNanAndInfFlag)
+#define PARSE_PRECISE      ::rapidjson::kParseFullPrecisionFlag
 
 
 /**
@@ -39,6 +44,7 @@ rapidjson::rapidjson(const std::string& strFilePath, const char& cNodePathSepara
  */
 rapidjson::~rapidjson()
 {
+    release();
 }
 
 /**
@@ -46,7 +52,7 @@ rapidjson::~rapidjson()
  * 
  * @return std::string Processing result (File path)
  */
-std::string rapidjson::path()
+std::string rapidjson::path() const
 {
     return m_strFilePath;
 }
@@ -55,31 +61,59 @@ std::string rapidjson::path()
  * @brief load the json file
  * 
  * @param strFilePath JSON file path
+ * @param eLoad File load mode
  * @return int Processing result
  */
-int rapidjson::load(const std::string& strFilePath)
+int rapidjson::load(const std::string& strFilePath, const LOAD& eLoad)
 {
     int iRet = 0;
     // Retrieve JSON file name
     std::string strFile = strFilePath.empty()? m_strFilePath: strFilePath;
-    // Check if file exist
-    if(!fs::file::exist(strFile))
+    // Check if file exist (document is not modified while read only)
+    if((m_bReadOnly) || 
+       (!fs::file::exist(strFile)))
     {
         // file not exist
         iRet = -1; 
     }
+    // Map file
+    if((!iRet) && 
+       (eLoad == LOAD::MMAP))
+    {
+        iRet = map(strFile);
+    }
+    // Index file (the bracket index needs the strict structure)
+    else if((!iRet) && 
+            (eLoad == LOAD::LAZY) && 
+            (!(m_uiParseFlags & (::rapidjson::kParseCommentsFlag | ::rapidjson::kParseTrailingCommasFlag))))
+    {
+        iRet = lazy(strFile);
+    }
+    // Scan file
+    else if((!iRet) && 
+            (m_eParser == PARSER::SIMD) && 
+            (m_uiParseFlags == ::rapidjson::kParseDefaultFlags))
+    {
+        iRet = scan(strFile);
+    }
     // Read file stream
-    if(!iRet)
+    else if(!iRet)
     {
         FILE* pFile = fopen(strFile.c_str(), "r");
         if(pFile)
         {
             char* pcReadBuffer = new char[FILE_BUFFER_SIZE];
             ::rapidjson::FileReadStream fileStream(pFile, pcReadBuffer, FILE_BUFFER_SIZE);
-            if(m_docJsonFile.ParseStream(fileStream).HasParseError() == true)
+            if(!dispatch([&](auto flags) { return !m_docJsonFile.ParseStream<decltype(flags)::value>(fileStream).HasParseError(); }))
             {
                 iRet = -1;
             }
+            else
+            {   // The document no longer references the owned buffers
+                release();
+            }
+            // Member indexes of the new document
+            indexBuild();
             // Delete allocated buffer
             delete[] pcReadBuffer;
             // Close file
@@ -96,1578 +130,4854 @@ int rapidjson::load(const std::string& strFilePath)
 }
 
 /**
- * @brief write and save the json file
+ * @brief Output stream on a file descriptor
  * 
- * @param strFilePath JSON file path
- * @return int int Processing result
+ * The writers only use Put and Flush; a failed write is kept in bError and
+ * the following data is dropped.
  */
-int rapidjson::save(const std::string& strFilePath)
+struct rapidjson::stFileStream
 {
-    int iRet = 0;
-    // Retrieve JSON file name
-    std::string strFile = strFilePath.empty()? m_strFilePath: strFilePath;
-    if(!iRet)
+    typedef char Ch;
+
+    int   iFile     {-1};
+    char* pcBuffer  {nullptr};
+    char* pcCurrent {nullptr};
+    char* pcEnd     {nullptr};
+    bool  bError    {false};
+
+    void Put(Ch cData)
     {
-        FILE* pFile = fopen(strFile.c_str(), "w");
-        if(pFile)
+        if(pcCurrent == pcEnd)
         {
-            char* pcWriteBuffer = new char[FILE_BUFFER_SIZE];
-            ::rapidjson::FileWriteStream fileWriterStream(pFile, pcWriteBuffer, FILE_BUFFER_SIZE);
-            ::rapidjson::PrettyWriter<::rapidjson::FileWriteStream> writer(fileWriterStream);
-            if(!m_docJsonFile.Accept(writer))
-            {
-                iRet = -1;
-            }
-            delete[] pcWriteBuffer;
-            iRet = fclose(pFile);
+            Flush();
         }
-        else
+        *pcCurrent++ = cData;
+    }
+
+    void Flush()
+    {
+        const char* pcData = pcBuffer;
+        while((!bError) && 
+              (pcData < pcCurrent))
         {
-            iRet = -2;
+            ssize_t lWritten = ::write(iFile, pcData, pcCurrent - pcData);
+            if(lWritten < 0)
+            {
+                if(errno != EINTR)
+                {
+                    bError = true;
+                }
+                continue;
+            }
+            pcData += lWritten;
         }
+        pcCurrent = pcBuffer;
     }
-    
-    // Processing result
-    return iRet;
-}
+
+    // Not used by the writers
+    Ch Peek() const { return 0; }
+    Ch Take() { return 0; }
+    size_t Tell() const { return 0; }
+    Ch* PutBegin() { return nullptr; }
+    size_t PutEnd(Ch*) { return 0; }
+};
 
 /**
- * @brief Get json string
- * 
- * @param bPrettyWriter JSON format writer status
- * @return std::string Processing result
+ * @brief Output stream appending to a string
  */
-std::string rapidjson::get(const bool& bPrettyWriter)
+struct rapidjson::stStringStream
 {
-    std::string strRet;
-    ::rapidjson::StringBuffer jsonBuffer;
-    
-    if(bPrettyWriter)
+    typedef char Ch;
+
+    std::string& strOut;
+
+    void Put(Ch cData)
     {
-        ::rapidjson::PrettyWriter<::rapidjson::StringBuffer> writer(jsonBuffer);
-        if(m_docJsonFile.Accept(writer))
-        {
-            strRet.assign(jsonBuffer.GetString(), jsonBuffer.GetLength());
-        }
-    } 
-    else
+        strOut.push_back(cData);
+    }
+
+    void Flush()
     {
-        ::rapidjson::Writer<::rapidjson::StringBuffer> writer(jsonBuffer);
-        if(m_docJsonFile.Accept(writer))
-        {
-            strRet.assign(jsonBuffer.GetString(), jsonBuffer.GetLength());
-        }
     }
-    
-    // Return processing result
-    return strRet;
-}
+
+    // Not used by the writers
+    Ch Peek() const { return 0; }
+    Ch Take() { return 0; }
+    size_t Tell() const { return 0; }
+    Ch* PutBegin() { return nullptr; }
+    size_t PutEnd(Ch*) { return 0; }
+};
 
 /**
- * @brief Set json string
+ * @brief Serialize a JSON node to an output stream
  * 
- * @param strData JSON data
- * @return std::string Processing result
+ * NaN and infinite numbers are written when they are accepted by the parse.
+ * 
+ * @tparam tStream Output stream type
+ * @param stream Output stream
+ * @param jsonValue JSON node
+ * @param format Output format
+ * @return bool Processing result
  */
-int rapidjson::set(const std::string& strData)
+template<typename tStream>
+inline bool rapidjson::serialize(tStream& stream, const ::rapidjson::Value& jsonValue, const stFormat& format) const
 {
-    // Return processing result
-    return m_docJsonFile.Parse(strData.c_str()).HasParseError()? -1: 0;
+    if(m_uiParseFlags & ::rapidjson::kParseNanAndInfFlag)
+    {
+        return serialize<::rapidjson::kWriteNanAndInfFlag>(stream, jsonValue, format);
+    }
+    return serialize<::rapidjson::kWriteDefaultFlags>(stream, jsonValue, format);
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Serialize a JSON node to an output stream with given write flags
  * 
- * @param strValue Value to retrieve
- * @param strNode JSON node path
- * @return int Processing result
+ * @tparam uiWriteFlags rapidjson write flags
+ * @tparam tStream Output stream type
+ * @param stream Output stream
+ * @param jsonValue JSON node
+ * @param format Output format
+ * @return bool Processing result
  */
-int rapidjson::get(std::string& strValue, const std::string& strNode)
-{   // Processing result
-    return process<std::string>(m_docJsonFile, strValue, strNode, stProcess::TYPE::GET);
+template<unsigned uiWriteFlags, typename tStream>
+inline bool rapidjson::serialize(tStream& stream, const ::rapidjson::Value& jsonValue, const stFormat& format)
+{
+    typedef ::rapidjson::UTF8<> tUtf8;
+    if(format.eFormat == FORMAT::PRETTY)
+    {   // rapidjson only indents with white spaces (asserted, not checked)
+        if((format.cIndent != ' ') && 
+           (format.cIndent != '\t') && 
+           (format.cIndent != '\n') && 
+           (format.cIndent != '\r'))
+        {
+            return false;
+        }
+        ::rapidjson::PrettyWriter<tStream, tUtf8, tUtf8, ::rapidjson::CrtAllocator, uiWriteFlags> writer(stream);
+        writer.SetIndent(format.cIndent, format.uiIndent);
+        return jsonValue.Accept(writer);
+    }
+
+    ::rapidjson::Writer<tStream, tUtf8, tUtf8, ::rapidjson::CrtAllocator, uiWriteFlags> writer(stream);
+    if((format.eFormat != FORMAT::LINES) || 
+       (!jsonValue.IsArray()))
+    {
+        return jsonValue.Accept(writer);
+    }
+    // One compact element per line
+    stream.Put('[');
+    for(::rapidjson::SizeType uiIndex = 0; uiIndex < jsonValue.Size(); uiIndex++)
+    {
+        if(uiIndex != 0)
+        {
+            stream.Put(',');
+        }
+        stream.Put('\n');
+        writer.Reset(stream);
+        if(!jsonValue[uiIndex].Accept(writer))
+        {
+            return false;
+        }
+    }
+    if(!jsonValue.Empty())
+    {
+        stream.Put('\n');
+    }
+    stream.Put(']');
+    stream.Flush();
+    return true;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Write a JSON node to a file descriptor
  * 
- * @param iValue Value to retrieve
- * @param strNode JSON node path
+ * @param iFile File descriptor
+ * @param jsonValue JSON node
+ * @param format Output format
  * @return int Processing result
  */
-int rapidjson::get(int& iValue, const std::string& strNode)
-{   // Processing result
-    return process<int>(m_docJsonFile, iValue, strNode, stProcess::TYPE::GET);
+inline int rapidjson::output(const int& iFile, const ::rapidjson::Value& jsonValue, const stFormat& format)
+{
+    int                           iRet     = 0;
+    std::unique_ptr<char, stFree> pcLocalBuffer;
+    char*                         pcBuffer = buffer(pcLocalBuffer);
+
+    if(pcBuffer == nullptr)
+    {
+        iRet = -1;
+    }
+    else
+    {
+        stFileStream fileStream;
+        fileStream.iFile     = iFile;
+        fileStream.pcBuffer  = pcBuffer;
+        fileStream.pcCurrent = fileStream.pcBuffer;
+        fileStream.pcEnd     = fileStream.pcBuffer + SAVE_BUFFER_SIZE;
+        bool bAccepted = serialize(fileStream, jsonValue, format);
+        fileStream.Flush();
+        iRet = (bAccepted && !fileStream.bError)? 0: -1;
+    }
+
+    // Return processing result
+    return iRet;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Write a JSON node to a file
  * 
- * @param uiValue Value to retrieve
- * @param strNode JSON node path 
+ * @param pFile File
+ * @param jsonValue JSON node
+ * @param format Output format
  * @return int Processing result
  */
-int rapidjson::get(uint64_t& ulValue, const std::string& strNode)
-{   // Processing result
-    return process<uint64_t>(m_docJsonFile, ulValue, strNode, stProcess::TYPE::GET);
+inline int rapidjson::output(FILE* pFile, const ::rapidjson::Value& jsonValue, const stFormat& format)
+{
+    int                           iRet     = 0;
+    std::unique_ptr<char, stFree> pcLocalBuffer;
+    char*                         pcBuffer = (pFile != nullptr)? buffer(pcLocalBuffer): nullptr;
+
+    if(pcBuffer == nullptr)
+    {
+        iRet = -1;
+    }
+    else
+    {
+        ::rapidjson::FileWriteStream fileStream(pFile, pcBuffer, SAVE_BUFFER_SIZE);
+        bool bAccepted = serialize(fileStream, jsonValue, format);
+        fileStream.Flush();
+        iRet = (bAccepted && !ferror(pFile))? 0: -1;
+    }
+
+    // Return processing result
+    return iRet;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Write buffer of an output
  * 
- * @param uiValue Value to retrieve
- * @param strNode JSON node path 
- * @return int Processing result
+ * The buffer of this object is allocated once, aligned for the file system.
+ * While read only, check callbacks may write from parallel workers: each
+ * output then gets its own buffer.
+ * 
+ * @param pcLocalBuffer Buffer of the output, used while read only
+ * @return char* Write buffer (nullptr if it can not be allocated)
  */
-int rapidjson::get(uint32_t& uiValue, const std::string& strNode)
-{  // Processing result
-    return process<uint32_t>(m_docJsonFile, uiValue, strNode, stProcess::TYPE::GET);
+inline char* rapidjson::buffer(std::unique_ptr<char, stFree>& pcLocalBuffer)
+{
+    std::unique_ptr<char, stFree>& pcBuffer = m_bReadOnly? pcLocalBuffer: m_pcWriteBuffer;
+
+    if(!pcBuffer)
+    {
+        pcBuffer.reset(static_cast<char*>(std::aligned_alloc(SAVE_BUFFER_ALIGN, SAVE_BUFFER_SIZE)));
+    }
+
+    // Return processing result
+    return pcBuffer.get();
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief write and save the json file
  * 
- * @param uValue Value to retrieve
- * @param strNode JSON node path 
- * @return int Processing result
+ * @param strFilePath JSON file path
+ * @return int int Processing result
  */
-int rapidjson::get(uint16_t& uValue, const std::string& strNode)
-{   // Processing result
-    return process<uint16_t>(m_docJsonFile, uValue, strNode, stProcess::TYPE::GET);
+int rapidjson::save(const std::string& strFilePath)
+{
+    stSaveConfig saveConfig;
+    saveConfig.bAtomic = false;
+    return save(strFilePath, saveConfig);
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief write and save the json file with a save configuration
  * 
- * @param ucValue Value to retrieve
- * @param strNode JSON node path 
+ * @param strFilePath JSON file path
+ * @param saveConfig Save configuration
  * @return int Processing result
  */
-int rapidjson::get(uint8_t& ucValue, const std::string& strNode)
-{   // Processing result
-    return process<uint8_t>(m_docJsonFile, ucValue, strNode, stProcess::TYPE::GET);
+int rapidjson::save(const std::string& strFilePath, const stSaveConfig& saveConfig)
+{
+    int         iRet         = 0;
+    int         iFile        = -1;
+    // Retrieve JSON file name
+    std::string strFile      = strFilePath.empty()? m_strFilePath: strFilePath;
+    std::string strDirectory = ".";
+    std::string strTemp;
+
+    // A lazy loaded document that does not parse is not written, the file is kept
+    if(materialize() != 0)
+    {
+        iRet = -1;
+    }
+    else if(saveConfig.bAtomic)
+    {   // Replace the target of a symbolic link, not the link itself
+        char* pcRealPath = realpath(strFile.c_str(), nullptr);
+        if(pcRealPath != nullptr)
+        {
+            strFile = pcRealPath;
+            free(pcRealPath);
+        }
+        // Temporary file in the target directory, so the rename stays atomic
+        size_t ulSeparator = strFile.rfind('/');
+        strTemp = "." + strFile + ".XXXXXX";
+        if(ulSeparator != std::string::npos)
+        {
+            strDirectory = (ulSeparator == 0)? "/": strFile.substr(0, ulSeparator);
+            strTemp      = strFile.substr(0, ulSeparator + 1) + "." + strFile.substr(ulSeparator + 1) + ".XXXXXX";
+        }
+        iFile = mkstemp(&strTemp[0]);
+        if(iFile >= 0)
+        {   // Keep the permissions of the replaced file (mkstemp creates it 0600)
+            struct stat fileStat;
+            mode_t      uiMode = (stat(strFile.c_str(), &fileStat) == 0)? (fileStat.st_mode & 07777): 0644;
+            iRet = (fchmod(iFile, uiMode) == 0)? 0: -1;
+        }
+    }
+    else
+    {
+        iFile = open(strFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    }
+    if(iFile < 0)
+    {   // Not opened, or not to be written
+        iRet = iRet? iRet: -2;
+    }
+    else
+    {
+        if(!iRet)
+        {
+            iRet = output(iFile, document(), saveConfig.format);
+        }
+        if(!iRet)
+        {
+            iRet = flush(iFile, saveConfig.eSync);
+        }
+        if((close(iFile) != 0) && (!iRet))
+        {
+            iRet = -1;
+        }
+    }
+    if((saveConfig.bAtomic) && 
+       (iFile >= 0))
+    {
+        if((!iRet) && 
+           (rename(strTemp.c_str(), strFile.c_str()) != 0))
+        {
+            iRet = -1;
+        }
+        if(iRet)
+        {
+            unlink(strTemp.c_str());
+        }
+        // Persist the directory entry of the renamed file
+        else if(saveConfig.eSync != stSaveConfig::SYNC::NONE)
+        {
+            int iDirectory = open(strDirectory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            iRet = ((iDirectory >= 0) && (fsync(iDirectory) == 0))? 0: -1;
+            if(iDirectory >= 0)
+            {
+                close(iDirectory);
+            }
+        }
+    }
+
+    // Processing result
+    return iRet;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Get json string
  * 
- * @param lValue Value to retrieve
- * @param strNode JSON node path
- * @return int Processing result
+ * @param bPrettyWriter JSON format writer status
+ * @return std::string Processing result
  */
-int rapidjson::get(int64_t& lValue, const std::string& strNode)
-{   // Processing result
-    return process<int64_t>(m_docJsonFile, lValue, strNode, stProcess::TYPE::GET);
+std::string rapidjson::get(const bool& bPrettyWriter) const
+{
+    std::string strRet;
+    stFormat    format;
+    format.eFormat = bPrettyWriter? FORMAT::PRETTY: FORMAT::COMPACT;
+    if(get(strRet, format))
+    {
+        strRet.clear();
+    }
+    
+    // Return processing result
+    return strRet;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Append the json string to a caller buffer (its capacity is kept)
  * 
- * @param sValue Value to retrieve
- * @param strNode JSON node path
+ * @param strOut Output buffer
+ * @param format Output format
  * @return int Processing result
  */
-int rapidjson::get(int16_t& sValue, const std::string& strNode)
-{   // Processing result
-    return process<int16_t>(m_docJsonFile, sValue, strNode, stProcess::TYPE::GET);
+int rapidjson::get(std::string& strOut, const stFormat& format) const
+{
+    stStringStream stringStream{strOut};
+    return ((!materialize()) && serialize(stringStream, document(), format))? 0: -1;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Append the json string to a caller buffer (its capacity is kept)
  * 
- * @param cValue Value to retrieve
- * @param strNode JSON node path
+ * @param jsonBuffer Output buffer
+ * @param format Output format
  * @return int Processing result
  */
-int rapidjson::get(int8_t& cValue, const std::string& strNode)
-{   // Processing result
-    return process<int8_t>(m_docJsonFile, cValue, strNode, stProcess::TYPE::GET);
+int rapidjson::get(::rapidjson::StringBuffer& jsonBuffer, const stFormat& format) const
+{
+    return ((!materialize()) && serialize(jsonBuffer, document(), format))? 0: -1;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Get the json string in the output buffer of this object
  * 
- * @param fValue Value to retrieve
- * @param strNode JSON node path
- * @return int Processing result
+ * @param format Output format
+ * @return std::string_view Processing result (empty on failure)
  */
-int rapidjson::get(float& fValue, const std::string& strNode)
-{   // Processing result
-    return process<float>(m_docJsonFile, fValue, strNode, stProcess::TYPE::GET);
+std::string_view rapidjson::get(const stFormat& format)
+{
+    std::string_view svRet;
+
+    // The output buffer is shared: not written while read only
+    if(!m_bReadOnly)
+    {   // Clear keeps the buffer capacity
+        m_jsonOutput.Clear();
+        if(!get(m_jsonOutput, format))
+        {
+            svRet = std::string_view(m_jsonOutput.GetString(), m_jsonOutput.GetSize());
+        }
+    }
+
+    // Return processing result
+    return svRet;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Write the json string to a file descriptor
  * 
- * @param dValue Value to retrieve
- * @param strNode JSON node path
+ * @param iFile File descriptor
+ * @param format Output format
  * @return int Processing result
  */
-int rapidjson::get(double& dValue, const std::string& strNode)
+int rapidjson::write(const int& iFile, const stFormat& format)
 {   // Processing result
-    return process<double>(m_docJsonFile, dValue, strNode, stProcess::TYPE::GET);
+    return materialize()? -1: output(iFile, document(), format);
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Write the json string to a file
  * 
- * @param bValue Value to retrieve
- * @param strNode JSON node path
+ * @param pFile File
+ * @param format Output format
  * @return int Processing result
  */
-int rapidjson::get(bool& bValue, const std::string& strNode)
+int rapidjson::write(FILE* pFile, const stFormat& format)
 {   // Processing result
-    return process<bool>(m_docJsonFile, bValue, strNode, stProcess::TYPE::GET);
+    return materialize()? -1: output(pFile, document(), format);
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Get the json string of a node (the document is not copied)
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path 
+ * @param strOut Node json string
+ * @param strNode JSON node path
+ * @param bPrettyWriter JSON format writer status
  * @return int Processing result
  */
-int rapidjson::get(std::vector<std::string>& vecValues, const std::string& strNode)
+int rapidjson::get(std::string& strOut, const std::string& strNode, const bool& bPrettyWriter) const
 {
-    return getVector(vecValues, strNode);
+    stFormat format;
+    format.eFormat = bPrettyWriter? FORMAT::PRETTY: FORMAT::COMPACT;
+    strOut.clear();
+    // Processing result
+    return get(strOut, strNode, format);
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Append the json string of a node to a caller buffer
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path 
+ * @param strOut Output buffer
+ * @param strNode JSON node path
+ * @param format Output format
  * @return int Processing result
  */
-int rapidjson::get(std::vector<uint64_t>& vecValues, const std::string& strNode)
+int rapidjson::get(std::string& strOut, const std::string& strNode, const stFormat& format) const
 {
-    return getVector(vecValues, strNode);
+    const ::rapidjson::Value* pNode = node(compile(strNode));
+    if(pNode == nullptr)
+    {
+        return -1;
+    }
+    stStringStream stringStream{strOut};
+    // Processing result
+    return serialize(stringStream, *pNode, format)? 0: -1;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Write the json string of a node to a file descriptor
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path 
+ * @param iFile File descriptor
+ * @param strNode JSON node path
+ * @param format Output format
  * @return int Processing result
  */
-int rapidjson::get(std::vector<uint32_t>& vecValues, const std::string& strNode)
+int rapidjson::write(const int& iFile, const std::string& strNode, const stFormat& format)
 {
-    return getVector(vecValues, strNode);
+    const ::rapidjson::Value* pNode = node(compile(strNode));
+    // Processing result
+    return (pNode != nullptr)? output(iFile, *pNode, format): -1;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Write the json string of a node to a file
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path 
+ * @param pFile File
+ * @param strNode JSON node path
+ * @param format Output format
  * @return int Processing result
  */
-int rapidjson::get(std::vector<uint16_t>& vecValues, const std::string& strNode)
+int rapidjson::write(FILE* pFile, const std::string& strNode, const stFormat& format)
 {
-    return getVector(vecValues, strNode);
+    const ::rapidjson::Value* pNode = node(compile(strNode));
+    // Processing result
+    return (pNode != nullptr)? output(pFile, *pNode, format): -1;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Set json string
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path 
- * @return int Processing result
+ * @param strData JSON data
+ * @return std::string Processing result
  */
-int rapidjson::get(std::vector<uint8_t>& vecValues, const std::string& strNode)
+int rapidjson::set(const std::string& strData)
 {
-    return getVector(vecValues, strNode);
+    // Document is not modified while read only
+    int iRet = m_bReadOnly? -1: 0;
+    if((!iRet) && 
+       (m_eParser == PARSER::SIMD) && 
+       (m_uiParseFlags == ::rapidjson::kParseDefaultFlags))
+    {
+        iRet = scan(strData.data(), strData.size());
+    }
+    else if(!iRet)
+    {
+        iRet = dispatch([&](auto flags) { return !m_docJsonFile.Parse<decltype(flags)::value>(strData.data(), strData.size()).HasParseError(); })? 0: -1;
+        // Member indexes of the new document
+        indexBuild();
+        if(!iRet)
+        {   // The document no longer references the owned buffers
+            release();
+        }
+    }
+    // Return processing result
+    return iRet;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Set json string in situ
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path 
+ * The string is parsed in place and kept by this object, the document strings
+ * reference it until the next load / set.
+ * 
+ * @param strData JSON data
  * @return int Processing result
  */
-int rapidjson::get(std::vector<int>& vecValues, const std::string& strNode)
-{
-    return getVector(vecValues, strNode);
+int rapidjson::set(std::string&& strData)
+{   // Own the string object itself: moving it again would relocate short strings
+    std::unique_ptr<std::string> pstrBuffer(new std::string(std::move(strData)));
+    // Document is not modified while read only
+    int iRet = m_bReadOnly? -1: 0;
+    if(!iRet)
+    {
+        iRet = dispatch([&](auto flags) { return !m_docJsonFile.ParseInsitu<decltype(flags)::value>(&(*pstrBuffer)[0]).HasParseError(); })? 0: -1;
+        // Member indexes of the new document
+        indexBuild();
+    }
+    if(!iRet)
+    {   // Keep the new buffer, release the previous ones
+        release();
+        m_pstrBuffer = std::move(pstrBuffer);
+    }
+    // Return processing result
+    return iRet;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Set json data in situ
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path 
+ * The data is parsed in place and kept by this object, the document strings
+ * reference it until the next load / set.
+ * 
+ * @param vecData JSON data (terminating zero optional)
  * @return int Processing result
  */
-int rapidjson::get(std::vector<int64_t>& vecValues, const std::string& strNode)
+int rapidjson::set(std::vector<char>&& vecData)
 {
-    return getVector(vecValues, strNode);
+    std::vector<char> vecBuffer(std::move(vecData));
+    if(vecBuffer.empty() || 
+       (vecBuffer.back() != '\0'))
+    {   // Terminate the data
+        vecBuffer.push_back('\0');
+    }
+    // Document is not modified while read only
+    int iRet = m_bReadOnly? -1: 0;
+    if(!iRet)
+    {
+        iRet = dispatch([&](auto flags) { return !m_docJsonFile.ParseInsitu<decltype(flags)::value>(vecBuffer.data()).HasParseError(); })? 0: -1;
+        // Member indexes of the new document
+        indexBuild();
+    }
+    if(!iRet)
+    {   // Keep the new buffer (moving a vector keeps its storage), release the previous ones
+        release();
+        m_vecBuffer = std::move(vecBuffer);
+    }
+    // Return processing result
+    return iRet;
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Set json data of a given length
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path 
+ * @param pcData JSON data
+ * @param ulSize JSON data length
  * @return int Processing result
  */
-int rapidjson::get(std::vector<int16_t>& vecValues, const std::string& strNode)
+int rapidjson::set(const char* pcData, const size_t& ulSize)
 {
-    return getVector(vecValues, strNode);
+    // Document is not modified while read only
+    int iRet = m_bReadOnly? -1: 0;
+    if((!iRet) && 
+       (m_eParser == PARSER::SIMD) && 
+       (m_uiParseFlags == ::rapidjson::kParseDefaultFlags))
+    {
+        iRet = scan(pcData, ulSize);
+    }
+    else if(!iRet)
+    {
+        iRet = dispatch([&](auto flags) { return !m_docJsonFile.Parse<decltype(flags)::value>(pcData, ulSize).HasParseError(); })? 0: -1;
+        // Member indexes of the new document
+        indexBuild();
+        if(!iRet)
+        {   // The document no longer references the owned buffers
+            release();
+        }
+    }
+    // Return processing result
+    return iRet;
 }
 
 /**
  * @brief Get JSON object value based its path
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path 
+ * @param strValue Value to retrieve
+ * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::get(std::vector<int8_t>& vecValues, const std::string& strNode)
-{
-    return getVector(vecValues, strNode);
+int rapidjson::get(std::string& strValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(strValue, compile(strNode));
 }
 
 /**
- * @brief Get JSON object value based its path
+ * @brief Get JSON object value based its path, without copy
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path 
+ * @param svValue Value to retrieve
+ * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::get(std::vector<float>& vecValues, const std::string& strNode)
-{
-    return getVector(vecValues, strNode);
+int rapidjson::get(std::string_view& svValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(svValue, compile(strNode));
 }
 
 /**
  * @brief Get JSON object value based its path
  * 
- * @param vecValues Value to retrieve
+ * @param iValue Value to retrieve
  * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::get(std::vector<double>& vecValues, const std::string& strNode)
-{
-    return getVector(vecValues, strNode);
+int rapidjson::get(int& iValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(iValue, compile(strNode));
 }
 
 /**
  * @brief Get JSON object value based its path
  * 
- * @param vecValues Value to retrieve
+ * @param uiValue Value to retrieve
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::get(std::vector<bool>& vecValues, const std::string& strNode)
-{
-    return getVector(vecValues, strNode);
+int rapidjson::get(uint64_t& ulValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(ulValue, compile(strNode));
 }
 
 /**
- * @brief Get the type of specific node
+ * @brief Get JSON object value based its path
  * 
+ * @param uiValue Value to retrieve
  * @param strNode JSON node path 
- * @return TYPE type of the node
+ * @return int Processing result
  */
-rapidjson::TYPE rapidjson::getType(const std::string& strNode)
-{   // Processing result
-    return process(m_docJsonFile, strNode);
+int rapidjson::get(uint32_t& uiValue, const std::string& strNode) const
+{  // Processing result
+    return getValue(uiValue, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param cValue Value to retrieve
- * @param strNode JSON node path
+ * @param uValue Value to retrieve
+ * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(char* cValue, const std::string& strNode)
-{    // Processing result
-    std::string strValue = std::string(cValue);
-    return set<std::string>(m_docJsonFile, strValue, strNode);
+int rapidjson::get(uint16_t& uValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(uValue, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param strValue Value to retrieve
- * @param strNode JSON node path
+ * @param ucValue Value to retrieve
+ * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::string& strValue, const std::string& strNode)
-{  // Processing result
-    return set<std::string>(m_docJsonFile, strValue, strNode);
+int rapidjson::get(uint8_t& ucValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(ucValue, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param iValue Value to retrieve
+ * @param lValue Value to retrieve
  * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::set(const int& iValue, const std::string& strNode)
-{   
-    return set<int>(m_docJsonFile, iValue, strNode);
+int rapidjson::get(int64_t& lValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(lValue, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param ulValue Value to retrieve
+ * @param sValue Value to retrieve
  * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::set(const uint64_t& ulValue, const std::string& strNode)
-{   
-    return set<uint64_t>(m_docJsonFile, ulValue, strNode);
+int rapidjson::get(int16_t& sValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(sValue, compile(strNode));
 }
+
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param uiValue Value to retrieve
+ * @param cValue Value to retrieve
  * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::set(const uint32_t& uiValue, const std::string& strNode)
-{   
-    return set<uint32_t>(m_docJsonFile, uiValue, strNode);
+int rapidjson::get(int8_t& cValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(cValue, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param usValue Value to retrieve
+ * @param fValue Value to retrieve
  * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::set(const uint16_t& usValue, const std::string& strNode)
-{   
-    return set<uint16_t>(m_docJsonFile, usValue, strNode);
+int rapidjson::get(float& fValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(fValue, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param cValue Value to retrieve
+ * @param dValue Value to retrieve
  * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::set(const uint8_t& cValue, const std::string& strNode)
-{   
-    return set<uint8_t>(m_docJsonFile, cValue, strNode);
+int rapidjson::get(double& dValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(dValue, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param lValue Value to retrieve
- * @param strNode JSON node path 
+ * @param bValue Value to retrieve
+ * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::set(const int64_t& lValue, const std::string& strNode)
-{   
-    return set<int64_t>(m_docJsonFile, lValue, strNode);
+int rapidjson::get(bool& bValue, const std::string& strNode) const
+{   // Processing result
+    return getValue(bValue, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param sValue Value to retrieve
+ * @param vecValues Value to retrieve
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const int16_t& sValue, const std::string& strNode)
-{   
-    return set<int16_t>(m_docJsonFile, sValue, strNode);
+int rapidjson::get(std::vector<std::string>& vecValues, const std::string& strNode) const
+{
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path, without copy
  * 
- * @param cValue Value to retrieve
- * @param strNode JSON node path 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::set(const int8_t& cValue, const std::string& strNode)
-{   
-    return set<int8_t>(m_docJsonFile, cValue, strNode);
+int rapidjson::get(std::vector<std::string_view>& vecValues, const std::string& strNode) const
+{
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param fValue Value to retrieve
- * @param strNode JSON node path
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const float& fValue, const std::string& strNode)
-{   
-    return set<float>(m_docJsonFile, fValue, strNode);
+int rapidjson::get(std::vector<uint64_t>& vecValues, const std::string& strNode) const
+{
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param fValue Value to retrieve
- * @param strNode JSON node path
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const double& fValue, const std::string& strNode)
-{   
-    return set<double>(m_docJsonFile, fValue, strNode);
+int rapidjson::get(std::vector<uint32_t>& vecValues, const std::string& strNode) const
+{
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
- * @param bValue Value to retrieve
- * @param strNode JSON node path
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const bool& bValue, const std::string& strNode)
-{   
-    return set<bool>(m_docJsonFile, bValue, strNode);
+int rapidjson::get(std::vector<uint16_t>& vecValues, const std::string& strNode) const
+{
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
  * @param vecValues Value to retrieve
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<std::string>& vecValues, const std::string& strNode)
+int rapidjson::get(std::vector<uint8_t>& vecValues, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
  * @param vecValues Value to retrieve
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<uint64_t>& vecValues, const std::string& strNode)
+int rapidjson::get(std::vector<int>& vecValues, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
  * @param vecValues Value to retrieve
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<uint32_t>& vecValues, const std::string& strNode)
+int rapidjson::get(std::vector<int64_t>& vecValues, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
  * @param vecValues Value to retrieve
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<uint16_t>& vecValues, const std::string& strNode)
+int rapidjson::get(std::vector<int16_t>& vecValues, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
  * @param vecValues Value to retrieve
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<uint8_t>& vecValues, const std::string& strNode)
+int rapidjson::get(std::vector<int8_t>& vecValues, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
  * @param vecValues Value to retrieve
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<int>& vecValues, const std::string& strNode)
+int rapidjson::get(std::vector<float>& vecValues, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
  * @param vecValues Value to retrieve
- * @param strNode JSON node path 
+ * @param strNode JSON node path
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<int64_t>& vecValues, const std::string& strNode)
+int rapidjson::get(std::vector<double>& vecValues, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON object value based its path
  * 
  * @param vecValues Value to retrieve
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<int16_t>& vecValues, const std::string& strNode)
+int rapidjson::get(std::vector<bool>& vecValues, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getVector(vecValues, strNode);
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON array values into a contiguous buffer based its path
  * 
- * @param vecValues Value to retrieve
+ * @param pdValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<int8_t>& vecValues, const std::string& strNode)
+int rapidjson::get(double* pdValues, size_t& ulSize, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getBuffer(pdValues, ulSize, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON array values into a contiguous buffer based its path
  * 
- * @param vecValues Value to retrieve
+ * @param pfValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<float>& vecValues, const std::string& strNode)
+int rapidjson::get(float* pfValues, size_t& ulSize, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getBuffer(pfValues, ulSize, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON array values into a contiguous buffer based its path
  * 
- * @param vecValues Value to retrieve
- * @param strNode JSON node path
+ * @param pulValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<double>& vecValues, const std::string& strNode)
+int rapidjson::get(uint64_t* pulValues, size_t& ulSize, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getBuffer(pulValues, ulSize, compile(strNode));
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Get JSON array values into a contiguous buffer based its path
  * 
- * @param vecValues Value to retrieve
+ * @param puiValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
  * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::set(const std::vector<bool>& vecValues, const std::string& strNode)
+int rapidjson::get(uint32_t* puiValues, size_t& ulSize, const std::string& strNode) const
 {
-    return setVector(vecValues, strNode);
+    return getBuffer(puiValues, ulSize, compile(strNode));
 }
+
 /**
- * @brief Remove object
+ * @brief Get JSON array values into a contiguous buffer based its path
  * 
- * @param strNode JSON node path
+ * @param pusValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param strNode JSON node path 
  * @return int Processing result
  */
-int rapidjson::remove(const std::string& strNode)
+int rapidjson::get(uint16_t* pusValues, size_t& ulSize, const std::string& strNode) const
 {
-    int iRemove = 0;
-    return process(m_docJsonFile, iRemove, strNode, stProcess::TYPE::REMOVE);
+    return getBuffer(pusValues, ulSize, compile(strNode));
 }
 
 /**
- * @brief check if object is empty
+ * @brief Get JSON array values into a contiguous buffer based its path
  * 
- * @param strNode JSON node path
- * @return bool Processing result
+ * @param pucValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param strNode JSON node path 
+ * @return int Processing result
  */
-bool rapidjson::empty(const std::string& strNode)
+int rapidjson::get(uint8_t* pucValues, size_t& ulSize, const std::string& strNode) const
 {
-    bool bRet  = false;
-    int iEmpty = 0;
-    if(process(m_docJsonFile, iEmpty, strNode, stProcess::TYPE::EMPTY))
-    {
-        bRet = true;
-    }
-    return bRet;
+    return getBuffer(pucValues, ulSize, compile(strNode));
 }
 
 /**
- * @brief check if  object exists
+ * @brief Get JSON array values into a contiguous buffer based its path
  * 
- * @param strNode JSON node path
- * @return bool Processing result
+ * @param piValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param strNode JSON node path 
+ * @return int Processing result
  */
-bool rapidjson::exist(const std::string& strNode)
+int rapidjson::get(int* piValues, size_t& ulSize, const std::string& strNode) const
 {
-    bool bRet  = false;
-    int iExist = 0;
-    if(!process(m_docJsonFile, iExist, strNode, stProcess::TYPE::EXIST))
-    {
-        bRet = true;
-    }
-    return bRet;
+    return getBuffer(piValues, ulSize, compile(strNode));
 }
 
 /**
- * @brief Get the size of the array based its path
+ * @brief Get JSON array values into a contiguous buffer based its path
  * 
- * @param strNode JSON node path
- * @return uint32_t Processing result
+ * @param plValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param strNode JSON node path 
+ * @return int Processing result
+ */
+int rapidjson::get(int64_t* plValues, size_t& ulSize, const std::string& strNode) const
+{
+    return getBuffer(plValues, ulSize, compile(strNode));
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its path
+ * 
+ * @param psValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param strNode JSON node path 
+ * @return int Processing result
+ */
+int rapidjson::get(int16_t* psValues, size_t& ulSize, const std::string& strNode) const
+{
+    return getBuffer(psValues, ulSize, compile(strNode));
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its path
+ * 
+ * @param pcValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param strNode JSON node path 
+ * @return int Processing result
+ */
+int rapidjson::get(int8_t* pcValues, size_t& ulSize, const std::string& strNode) const
+{
+    return getBuffer(pcValues, ulSize, compile(strNode));
+}
+
+/**
+ * @brief Get the type of specific node
+ * 
+ * @param strNode JSON node path 
+ * @return TYPE type of the node
+ */
+rapidjson::TYPE rapidjson::getType(const std::string& strNode) const
+{
+    stPath path = compile(strNode);
+    // Processing result (an empty or invalid path addresses no node)
+    return path.vecSegments.empty()? TYPE::UKNOWN: getType(path);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param cValue Value to retrieve
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(char* cValue, const std::string& strNode)
+{    // Processing result
+    std::string strValue = std::string(cValue);
+    return materialize()? -1: set<std::string>(document(), strValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param strValue Value to retrieve
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const std::string& strValue, const std::string& strNode)
+{  // Processing result
+    return materialize()? -1: set<std::string>(document(), strValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param iValue Value to retrieve
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const int& iValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<int>(document(), iValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param ulValue Value to retrieve
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const uint64_t& ulValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<uint64_t>(document(), ulValue, compile(strNode));
+}
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param uiValue Value to retrieve
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const uint32_t& uiValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<uint32_t>(document(), uiValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param usValue Value to retrieve
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const uint16_t& usValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<uint16_t>(document(), usValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param cValue Value to retrieve
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const uint8_t& cValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<uint8_t>(document(), cValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param lValue Value to retrieve
+ * @param strNode JSON node path 
+ * @return int Processing result
+ */
+int rapidjson::set(const int64_t& lValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<int64_t>(document(), lValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param sValue Value to retrieve
+ * @param strNode JSON node path 
+ * @return int Processing result
+ */
+int rapidjson::set(const int16_t& sValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<int16_t>(document(), sValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param cValue Value to retrieve
+ * @param strNode JSON node path 
+ * @return int Processing result
+ */
+int rapidjson::set(const int8_t& cValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<int8_t>(document(), cValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param fValue Value to retrieve
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const float& fValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<float>(document(), fValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param fValue Value to retrieve
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const double& fValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<double>(document(), fValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param bValue Value to retrieve
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const bool& bValue, const std::string& strNode)
+{   
+    return materialize()? -1: set<bool>(document(), bValue, compile(strNode));
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<std::string>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<uint64_t>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<uint32_t>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<uint16_t>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<uint8_t>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<int>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<int64_t>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<int16_t>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<int8_t>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<float>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<double>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its path
+ * 
+ * @param vecValues Value to retrieve
+ * @param strNode JSON node path 
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<bool>& vecValues, const std::string& strNode, const SET_MODE& eMode)
+{
+    return setVector(vecValues, strNode, eMode);
+}
+/**
+ * @brief Remove object
+ * 
+ * @param strNode JSON node path
+ * @return int Processing result
+ */
+int rapidjson::remove(const std::string& strNode)
+{   // Processing result
+    return remove(compile(strNode));
+}
+
+/**
+ * @brief check if object is empty
+ * 
+ * @param strNode JSON node path
+ * @return bool Processing result
+ */
+bool rapidjson::empty(const std::string& strNode) const
+{
+    return empty(compile(strNode));
+}
+
+/**
+ * @brief check if  object exists
+ * 
+ * @param strNode JSON node path
+ * @return bool Processing result
+ */
+bool rapidjson::exist(const std::string& strNode) const
+{
+    return exist(compile(strNode));
+}
+
+/**
+ * @brief Get the size of the array based its path
+ * 
+ * @param strNode JSON node path
+ * @return uint32_t Processing result
+ */
+uint32_t rapidjson::size(const std::string& strNode) const
+{
+    stPath path = compile(strNode);
+    // Processing result (an empty or invalid path addresses no node)
+    return path.vecSegments.empty()? 0: size(path);
+}
+
+/**
+ * @brief Get the number of bytes allocated by the document allocator
+ * 
+ * @return size_t Processing result
+ */
+size_t rapidjson::allocated() const
+{   // Processing result
+    return m_allocator.Size() + lazyAllocated();
+}
+
+/**
+ * @brief Enable the hashed member index of wide objects
+ * 
+ * @param uiThreshold Member count from which an object is indexed (0: disabled)
+ */
+void rapidjson::index(const uint32_t& uiThreshold)
+{
+    if(!m_bReadOnly)
+    {
+        m_uiIndexThreshold = uiThreshold;
+        indexBuild();
+    }
+}
+
+/**
+ * @brief Select the parse front-end of load (STREAM) and set (copied data)
+ * 
+ * @param eParser Parse front-end
+ */
+void rapidjson::parser(const PARSER& eParser)
+{
+    if(!m_bReadOnly)
+    {
+        m_eParser = eParser;
+    }
+}
+
+/**
+ * @brief Set the parse options of load and set
+ * 
+ * @param parseConfig Parse options
+ */
+void rapidjson::parser(const stParseConfig& parseConfig)
+{
+    if(!m_bReadOnly)
+    {
+        m_uiParseFlags = ::rapidjson::kParseDefaultFlags;
+        m_uiParseFlags |= parseConfig.bRelaxed? PARSE_RELAXED: 0;
+        m_uiParseFlags |= parseConfig.bFullPrecision? PARSE_PRECISE: 0;
+    }
+}
+
+/**
+ * @brief Call a parse with the parse flags of this object as template argument
+ * 
+ * The parse is called with std::integral_constant<unsigned, flags> for one of
+ * the four supported flag combinations (strict or relaxed syntax, fast or
+ * full precision numbers), so each parse site is instantiated four times.
+ * 
+ * @tparam tParse Parse type
+ * @param parse Parse, returning its processing result
+ * @return bool Processing result of the parse
+ */
+template<typename tParse>
+inline bool rapidjson::dispatch(tParse&& parse) const
+{
+    bool bRet = false;
+
+    switch(m_uiParseFlags)
+    {
+        case PARSE_PRECISE:
+            bRet = parse(std::integral_constant<unsigned, PARSE_PRECISE>());
+            break;
+        case PARSE_RELAXED:
+            bRet = parse(std::integral_constant<unsigned, PARSE_RELAXED>());
+            break;
+        case PARSE_RELAXED | PARSE_PRECISE:
+            bRet = parse(std::integral_constant<unsigned, PARSE_RELAXED | PARSE_PRECISE>());
+            break;
+        default:
+            bRet = parse(std::integral_constant<unsigned, ::rapidjson::kParseDefaultFlags>());
+            break;
+    }
+
+    // Return processing result
+    return bRet;
+}
+
+/**
+ * @brief Compile a JSON node path
+ * 
+ * @param strNode JSON node path
+ * @return stPath Compiled JSON node path (empty if the path is invalid)
+ */
+rapidjson::stPath rapidjson::compile(const std::string& strNode) const
+{
+    stPath      path;
+    std::string strPath = strNode;
+    std::string strNodePath;
+    std::string strChildren;
+    uint64_t    ulArrayElemnt = 0;
+
+    // Loop over all path segments
+    while(!strPath.empty())
+    {
+        split(strPath, strNodePath, strChildren, ulArrayElemnt);
+        // Check node name
+        if(strNodePath.empty())
+        {
+            path.vecSegments.clear();
+            break;
+        }
+        // Add segment
+        stPath::stSegment segment;
+        segment.strName       = strNodePath;
+        segment.uiLength      = static_cast<uint32_t>(strNodePath.size());
+        segment.uiHash        = hash(strNodePath.c_str(), strNodePath.size());
+        segment.ulArrayElemnt = ulArrayElemnt;
+        path.vecSegments.push_back(segment);
+        // Next segment
+        strPath = strChildren;
+    }
+
+    // Return processing result
+    return path;
+}
+
+/**
+ * @brief Compile a nodes configuration
+ * 
+ * Rules are laid out breadth first so the children of a rule are contiguous.
+ * A nodes map reached again (shared or recursive configuration) reuses the
+ * rules range already compiled for it.
+ * 
+ * @param mapNodes Nodes map
+ * @return stSchema Compiled nodes configuration
+ */
+rapidjson::stSchema rapidjson::compile(const std::map<std::string, stNodeConfig>& mapNodes) const
+{
+    stSchema schema;
+    std::map<const std::map<std::string, stNodeConfig>*, std::pair<uint32_t, uint32_t>> mapRanges;
+    std::vector<const stNodeConfig*> vecConfigs;
+
+    // Add the rules of a nodes map, return their range
+    auto add = [&](const std::map<std::string, stNodeConfig>& mapItems)
+    {
+        auto itRange = mapRanges.find(&mapItems);
+        if(itRange == mapRanges.end())
+        {
+            std::pair<uint32_t, uint32_t> pairRange(static_cast<uint32_t>(schema.vecRules.size()), static_cast<uint32_t>(mapItems.size()));
+            itRange = mapRanges.emplace(&mapItems, pairRange).first;
+            for(const std::pair<const std::string, stNodeConfig>& pairMapNodes: mapItems)
+            {
+                stSchema::stRule rule;
+                rule.strName       = pairMapNodes.first;
+                rule.path          = compile(pairMapNodes.first);
+                rule.eType         = pairMapNodes.second.eType;
+                rule.usTypeMask    = static_cast<uint16_t>(pairMapNodes.second.eType);
+                rule.bOptional     = pairMapNodes.second.bOptional;
+                rule.bNull         = pairMapNodes.second.bNull;
+                rule.bEmpty        = pairMapNodes.second.bEmpty;
+                rule.callback      = pairMapNodes.second.callback;
+                rule.constCallback = pairMapNodes.second.constCallback;
+                schema.vecRules.push_back(rule);
+                vecConfigs.push_back(&pairMapNodes.second);
+            }
+        }
+        return itRange->second;
+    };
+
+    schema.uiRootCount = add(mapNodes).second;
+    // Children are only checked for object and array (of objects) nodes
+    for(size_t ulRule = 0; ulRule < schema.vecRules.size(); ++ulRule)
+    {
+        const stNodeConfig* pNodeConfig = vecConfigs[ulRule];
+        if((pNodeConfig->mapNodeItems != nullptr) && 
+           ((pNodeConfig->eType == TYPE::OBJECT) || (pNodeConfig->eType == TYPE::ARRAY)))
+        {
+            std::pair<uint32_t, uint32_t> pairRange = add(*pNodeConfig->mapNodeItems);
+            schema.vecRules[ulRule].uiFirstChild = pairRange.first;
+            schema.vecRules[ulRule].uiChildCount = pairRange.second;
+        }
+    }
+
+    // Return processing result
+    return schema;
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param strValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::string& strValue, const stPath& path) const
+{   // Processing result
+    return getValue(strValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path, without copy
+ * 
+ * @param svValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::string_view& svValue, const stPath& path) const
+{   // Processing result
+    return getValue(svValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param iValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(int& iValue, const stPath& path) const
+{   // Processing result
+    return getValue(iValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param ulValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(uint64_t& ulValue, const stPath& path) const
+{   // Processing result
+    return getValue(ulValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param uiValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(uint32_t& uiValue, const stPath& path) const
+{   // Processing result
+    return getValue(uiValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param usValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(uint16_t& usValue, const stPath& path) const
+{   // Processing result
+    return getValue(usValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param ucValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(uint8_t& ucValue, const stPath& path) const
+{   // Processing result
+    return getValue(ucValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param lValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(int64_t& lValue, const stPath& path) const
+{   // Processing result
+    return getValue(lValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param sValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(int16_t& sValue, const stPath& path) const
+{   // Processing result
+    return getValue(sValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param cValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(int8_t& cValue, const stPath& path) const
+{   // Processing result
+    return getValue(cValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param fValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(float& fValue, const stPath& path) const
+{   // Processing result
+    return getValue(fValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param dValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(double& dValue, const stPath& path) const
+{   // Processing result
+    return getValue(dValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param bValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(bool& bValue, const stPath& path) const
+{   // Processing result
+    return getValue(bValue, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<std::string>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path, without copy
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<std::string_view>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<uint64_t>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<uint32_t>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<uint16_t>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<uint8_t>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<int>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<int64_t>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<int16_t>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<int8_t>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<float>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<double>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON object value based its compiled path
+ * 
+ * @param vecValues Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(std::vector<bool>& vecValues, const stPath& path) const
+{
+    return getVector(vecValues, path);
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its compiled path
+ * 
+ * @param pdValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(double* pdValues, size_t& ulSize, const stPath& path) const
+{
+    return getBuffer(pdValues, ulSize, path);
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its compiled path
+ * 
+ * @param pfValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(float* pfValues, size_t& ulSize, const stPath& path) const
+{
+    return getBuffer(pfValues, ulSize, path);
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its compiled path
+ * 
+ * @param pulValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(uint64_t* pulValues, size_t& ulSize, const stPath& path) const
+{
+    return getBuffer(pulValues, ulSize, path);
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its compiled path
+ * 
+ * @param puiValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(uint32_t* puiValues, size_t& ulSize, const stPath& path) const
+{
+    return getBuffer(puiValues, ulSize, path);
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its compiled path
+ * 
+ * @param pusValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(uint16_t* pusValues, size_t& ulSize, const stPath& path) const
+{
+    return getBuffer(pusValues, ulSize, path);
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its compiled path
+ * 
+ * @param pucValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(uint8_t* pucValues, size_t& ulSize, const stPath& path) const
+{
+    return getBuffer(pucValues, ulSize, path);
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its compiled path
+ * 
+ * @param piValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(int* piValues, size_t& ulSize, const stPath& path) const
+{
+    return getBuffer(piValues, ulSize, path);
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its compiled path
+ * 
+ * @param plValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(int64_t* plValues, size_t& ulSize, const stPath& path) const
+{
+    return getBuffer(plValues, ulSize, path);
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its compiled path
+ * 
+ * @param psValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(int16_t* psValues, size_t& ulSize, const stPath& path) const
+{
+    return getBuffer(psValues, ulSize, path);
+}
+
+/**
+ * @brief Get JSON array values into a contiguous buffer based its compiled path
+ * 
+ * @param pcValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::get(int8_t* pcValues, size_t& ulSize, const stPath& path) const
+{
+    return getBuffer(pcValues, ulSize, path);
+}
+
+/**
+ * @brief Get the type of specific node
+ * 
+ * @param path Compiled JSON node path
+ * @return TYPE type of the node
+ */
+rapidjson::TYPE rapidjson::getType(const stPath& path) const
+{
+    const ::rapidjson::Value* pNode = node(path);
+    // Processing result
+    return (pNode != nullptr)? type(*pNode): TYPE::UKNOWN;
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param pcValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const char* pcValue, const stPath& path)
+{   // Processing result
+    std::string strValue = std::string(pcValue);
+    return materialize()? -1: set<std::string>(document(), strValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param strValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const std::string& strValue, const stPath& path)
+{
+    return materialize()? -1: set<std::string>(document(), strValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param iValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const int& iValue, const stPath& path)
+{
+    return materialize()? -1: set<int>(document(), iValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param ulValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const uint64_t& ulValue, const stPath& path)
+{
+    return materialize()? -1: set<uint64_t>(document(), ulValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param uiValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const uint32_t& uiValue, const stPath& path)
+{
+    return materialize()? -1: set<uint32_t>(document(), uiValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param usValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const uint16_t& usValue, const stPath& path)
+{
+    return materialize()? -1: set<uint16_t>(document(), usValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param ucValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const uint8_t& ucValue, const stPath& path)
+{
+    return materialize()? -1: set<uint8_t>(document(), ucValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param lValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const int64_t& lValue, const stPath& path)
+{
+    return materialize()? -1: set<int64_t>(document(), lValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param sValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const int16_t& sValue, const stPath& path)
+{
+    return materialize()? -1: set<int16_t>(document(), sValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param cValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const int8_t& cValue, const stPath& path)
+{
+    return materialize()? -1: set<int8_t>(document(), cValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param fValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const float& fValue, const stPath& path)
+{
+    return materialize()? -1: set<float>(document(), fValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param dValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const double& dValue, const stPath& path)
+{
+    return materialize()? -1: set<double>(document(), dValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param bValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::set(const bool& bValue, const stPath& path)
+{
+    return materialize()? -1: set<bool>(document(), bValue, path);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<std::string>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<uint64_t>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<uint32_t>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<uint16_t>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<uint8_t>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<int>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<int64_t>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<int16_t>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<int8_t>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<float>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<double>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @param vecValues Value to set
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int Processing result
+ */
+int rapidjson::set(const std::vector<bool>& vecValues, const stPath& path, const SET_MODE& eMode)
+{
+    return setVector(vecValues, path, eMode);
+}
+
+/**
+ * @brief Remove object
+ * 
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+int rapidjson::remove(const stPath& path)
+{
+    int iRemove = 0;
+    return (m_bReadOnly || materialize())? -1: process(document(), iRemove, path, stProcess::TYPE::REMOVE);
+}
+
+/**
+ * @brief check if object is empty
+ * 
+ * @param path Compiled JSON node path
+ * @return bool Processing result
+ */
+bool rapidjson::empty(const stPath& path) const
+{
+    const ::rapidjson::Value* pNode = node(path);
+    return ((pNode == nullptr) || (pNode->IsNull()));
+}
+
+/**
+ * @brief check if object exists
+ * 
+ * @param path Compiled JSON node path
+ * @return bool Processing result
+ */
+bool rapidjson::exist(const stPath& path) const
+{
+    return (node(path) != nullptr);
+}
+
+/**
+ * @brief Get the size of the array based its compiled path
+ * 
+ * @param path Compiled JSON node path
+ * @return uint32_t Processing result
+ */
+uint32_t rapidjson::size(const stPath& path) const
+{
+    uint32_t            uiRet = 0;
+    const ::rapidjson::Value* pNode = node(path);
+
+    if((pNode != nullptr) && 
+       (pNode->IsArray()))
+    {
+        uiRet = pNode->Size();
+    }
+
+    // Processing result
+    return uiRet;
+}
+
+/**
+ * @brief Check configuration
+ *
+ * @param strConfig Configuration string
+ * @param mapNodes Nodes map
+ * @param vecCheckRet Check result vector
+ * @return int Processing result
+ */
+int rapidjson::check(const std::string& strConfig, const std::map<std::string, stNodeConfig>& mapNodes, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+{   // Serial check
+    return check(strConfig, mapNodes, stCheckConfig(), vecCheckRet);
+}
+
+/**
+ * @brief Check configuration with an execution configuration
+ *
+ * @param strConfig Configuration string
+ * @param mapNodes Nodes map
+ * @param checkConfig Check execution configuration
+ * @param vecCheckRet Check result vector
+ * @return int Processing result
+ */
+int rapidjson::check(const std::string& strConfig, const std::map<std::string, stNodeConfig>& mapNodes, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+{
+    int iRet = 0;
+    // Initialization
+    vecCheckRet.clear();
+    
+    // Check if strConfig is empty
+    if(strConfig.empty())
+    { 
+        iRet = -1;
+    }
+    if(!iRet)
+    {   // Compile the nodes map, then check against it
+        iRet = check(strConfig, compile(mapNodes), checkConfig, vecCheckRet);
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Check configuration against a compiled schema
+ *
+ * @param strConfig Configuration string
+ * @param schema Compiled nodes configuration
+ * @param vecCheckRet Check result vector
+ * @return int Processing result
+ */
+int rapidjson::check(const std::string& strConfig, const stSchema& schema, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+{   // Serial check
+    return check(strConfig, schema, stCheckConfig(), vecCheckRet);
+}
+
+/**
+ * @brief Check configuration against a compiled schema with an execution configuration
+ *
+ * @param strConfig Configuration string
+ * @param schema Compiled nodes configuration
+ * @param checkConfig Check execution configuration
+ * @param vecCheckRet Check result vector
+ * @return int Processing result
+ */
+int rapidjson::check(const std::string& strConfig, const stSchema& schema, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+{
+    int iRet = 0;
+    // Initialization
+    vecCheckRet.clear();
+    
+    // Check if strConfig is empty
+    if(strConfig.empty())
+    { 
+        iRet = -1;
+    }
+    if((!iRet) && 
+       (checkConfig.bStream))
+    {   // Reject an invalid configuration before building its document
+        iRet = stream(strConfig, schema, vecCheckRet);
+    }
+    if(!iRet)
+    {
+        // Load string configuration in a json object
+        iRet = set(strConfig.c_str(), strConfig.size());
+    }
+    if(!iRet)
+    {
+        iRet = check(schema, checkConfig, vecCheckRet);
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Check the loaded configuration against a compiled schema
+ *
+ * @param schema Compiled nodes configuration
+ * @param vecCheckRet Check result vector
+ * @return int Processing result
+ */
+int rapidjson::check(const stSchema& schema, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+{   // Serial check
+    return check(schema, stCheckConfig(), vecCheckRet);
+}
+
+/**
+ * @brief Check the loaded configuration against a compiled schema with an execution configuration
+ *
+ * @param schema Compiled nodes configuration
+ * @param checkConfig Check execution configuration
+ * @param vecCheckRet Check result vector
+ * @return int Processing result
+ */
+int rapidjson::check(const stSchema& schema, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+{
+    int         iRet      = 0;
+    std::string strPath;
+    // The walk keeps references into the document: workers and callbacks only read it
+    const bool  bReadOnly = m_bReadOnly;
+    // Initialization
+    vecCheckRet.clear();
+
+    if(!bReadOnly)
+    {
+        m_bReadOnly = true;
+    }
+    // Walk the document and the rules together
+    iRet = materialize();
+    if(!iRet)
+    {
+        iRet = check(document(), strPath, schema, 0, schema.uiRootCount, checkConfig, vecCheckRet);
+    }
+    if(!bReadOnly)
+    {
+        m_bReadOnly = false;
+    }
+    // Keep the reported errors within the budget
+    if((limit(checkConfig) != 0) && 
+       (vecCheckRet.size() > limit(checkConfig)))
+    {
+        vecCheckRet.resize(limit(checkConfig));
+    }
+    // Check if Check result vector is empty
+    if(!vecCheckRet.empty())
+    {
+        iRet = -2;
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Check a resolved node and its children in a single pass
+ * 
+ * The node is resolved once by the caller, children are resolved from it, so
+ * no path is walked again from the root.
+ * 
+ * @param pNode JSON node (nullptr if it does not exist)
+ * @param strPath JSON node path, used as buffer for the children paths
+ * @param schema Compiled nodes configuration
+ * @param rule Rule of the node
+ * @param checkConfig Check execution configuration
+ * @param vecCheckRet Check result vector
+ * @return int Processing result
+ */
+int rapidjson::check(::rapidjson::Value* pNode, std::string& strPath, const stSchema& schema, const stSchema::stRule& rule, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+{
+    int iRet = 0;
+
+    // Check if node exist
+    if(pNode == nullptr)
+    {
+        if(!rule.bOptional)
+        {// Node dos not exist but mandatory
+            vecCheckRet.push_back({strPath, CHECK_ERROR::MISSING_NODE});
+            iRet = -1;
+        }
+    }
+    // Check if node is null
+    else if(pNode->IsNull())
+    {
+        if(!rule.bNull)
+        {// Node is null but should not be null 
+            vecCheckRet.push_back({strPath, CHECK_ERROR::UNABLE_TO_GET});
+            iRet = -1;
+        }
+    }
+    else
+    {
+        // Check node type
+        if(!(static_cast<uint16_t>(type(*pNode)) & rule.usTypeMask))
+        {
+            vecCheckRet.push_back({strPath, CHECK_ERROR::BAD_FORMAT});
+            iRet = -1;
+        }
+        // Check if Node is Empty (case: string/array)
+        if(!iRet)
+        {
+            // Switch node type
+            switch(rule.eType)
+            {
+                // Case string node   
+                case TYPE::STRING:
+                    if((pNode->GetStringLength() == 0) &&
+                       (!rule.bEmpty))
+                    {// Node is empty but should not be empty
+                        vecCheckRet.push_back({strPath, CHECK_ERROR::BAD_VALUE});
+                        iRet = -1;
+                    }
+                    break;
+                // Case array node 
+                case TYPE::ARRAY:
+                {
+                    ::rapidjson::SizeType uiSize = pNode->Size();
+                    if((uiSize == 0) && 
+                       (!rule.bEmpty))
+                    {// Node is empty but should not be empty
+                        vecCheckRet.push_back({strPath, CHECK_ERROR::EMPTY_ARRAY});
+                        iRet = -1;
+                    }
+                    if((!iRet) &&
+                       (rule.uiChildCount != 0))
+                    {
+                        uint32_t uiThreads = (checkConfig.uiThreads == 0)? std::thread::hardware_concurrency(): checkConfig.uiThreads;
+                        uiThreads = std::min<uint32_t>(std::max<uint32_t>(uiThreads, 1), uiSize);
+                        if((uiThreads > 1) && 
+                           (uiSize >= checkConfig.uiMinItems))
+                        {   // Split the items into contiguous chunks, one per worker
+                            std::vector<std::thread>                                           vecWorkers;
+                            std::vector<std::vector<std::pair<std::string, CHECK_ERROR>>>     vecWorkerRet(uiThreads);
+                            std::vector<int>                                                   vecWorkerStatus(uiThreads, 0);
+                            std::atomic<size_t>                                                ulErrors {0};
+                            // Nested arrays of a worker are checked serially; the workers share
+                            // the remaining budget, the items of a worker may exceed it (merge is truncated)
+                            stCheckConfig workerConfig = checkConfig;
+                            workerConfig.uiThreads   = 1;
+                            workerConfig.bFailFast   = false;
+                            workerConfig.uiMaxErrors = (limit(checkConfig) != 0)? static_cast<uint32_t>(limit(checkConfig) - std::min(vecCheckRet.size(), limit(checkConfig))): 0;
+                            for(uint32_t uiWorker = 0; uiWorker < uiThreads; ++uiWorker)
+                            {
+                                ::rapidjson::SizeType uiBegin = static_cast<::rapidjson::SizeType>((static_cast<uint64_t>(uiSize) * uiWorker) / uiThreads);
+                                ::rapidjson::SizeType uiEnd   = static_cast<::rapidjson::SizeType>((static_cast<uint64_t>(uiSize) * (uiWorker + 1)) / uiThreads);
+                                vecWorkers.emplace_back([&, uiWorker, uiBegin, uiEnd]()
+                                {
+                                    std::string strWorkerPath = strPath;
+                                    vecWorkerStatus[uiWorker] = check(*pNode, strWorkerPath, schema, rule, uiBegin, uiEnd, workerConfig, vecWorkerRet[uiWorker], &ulErrors);
+                                });
+                            }
+                            // Merge the results in items order, up to the budget
+                            for(uint32_t uiWorker = 0; uiWorker < uiThreads; ++uiWorker)
+                            {
+                                vecWorkers[uiWorker].join();
+                                size_t ulCount = vecWorkerRet[uiWorker].size();
+                                if(limit(checkConfig) != 0)
+                                {
+                                    ulCount = std::min(ulCount, limit(checkConfig) - std::min(vecCheckRet.size(), limit(checkConfig)));
+                                }
+                                vecCheckRet.insert(vecCheckRet.end(), vecWorkerRet[uiWorker].begin(), vecWorkerRet[uiWorker].begin() + ulCount);
+                                if(vecWorkerStatus[uiWorker])
+                                {
+                                    iRet = -1;
+                                }
+                            }
+                        }
+                        else
+                        {
+                            iRet = check(*pNode, strPath, schema, rule, 0, uiSize, checkConfig, vecCheckRet, nullptr);
+                        }
+                    }
+                    break;
+                }
+                case TYPE::OBJECT:
+                    iRet = check(*pNode, strPath, schema, rule.uiFirstChild, rule.uiChildCount, checkConfig, vecCheckRet);
+                    break;
+                default: 
+                    break;
+            }
+        }
+        if((!iRet) && 
+           (rule.constCallback != nullptr))
+        {
+            // Call the read only callback function with the path of this node
+            iRet = rule.constCallback(static_cast<const rapidjson&>(*this), strPath, vecCheckRet);
+        }
+        else if((!iRet) && 
+                (rule.callback != nullptr))
+        {
+            // Call the callback function with the path of this node
+            iRet = rule.callback(*this, strPath, vecCheckRet);
+        }
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Check the children of an object node
+ * 
+ * @param jsonObject JSON object node
+ * @param strPath JSON node path, used as buffer for the children paths
+ * @param schema Compiled nodes configuration
+ * @param uiFirst First rule of the children
+ * @param uiCount Number of children rules
+ * @param checkConfig Check execution configuration
+ * @param vecCheckRet Check result vector
+ * @return int Processing result
+ */
+int rapidjson::check(::rapidjson::Value& jsonObject, std::string& strPath, const stSchema& schema, const uint32_t& uiFirst, const uint32_t& uiCount, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+{
+    int          iRet     = 0;
+    const size_t ulLength = strPath.size();
+
+    // Loop over all children rules, while the error budget is not exhausted
+    for(uint32_t uiRule = uiFirst; uiRule < uiFirst + uiCount; ++uiRule)
+    {
+        if((limit(checkConfig) != 0) && 
+           (vecCheckRet.size() >= limit(checkConfig)))
+        {
+            iRet = -1;
+            break;
+        }
+        const stSchema::stRule& rule = schema.vecRules[uiRule];
+        if(ulLength != 0)
+        {
+            strPath += m_cNodePathSeparator;
+        }
+        strPath += rule.strName;
+        // Check node
+        if(check(find(jsonObject, rule.path), strPath, schema, rule, checkConfig, vecCheckRet))
+        {
+            iRet = -1;
+        }
+        strPath.resize(ulLength);
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Check a range of the items of an array of objects
+ * 
+ * @param jsonArray JSON array node
+ * @param strPath JSON array path, used as buffer for the items paths
+ * @param schema Compiled nodes configuration
+ * @param rule Rule of the array
+ * @param uiBegin First item
+ * @param uiEnd Item after the last one
+ * @param checkConfig Check execution configuration
+ * @param vecCheckRet Check result vector
+ * @param pErrors Error count shared by the parallel workers (nullptr: serial check)
+ * @return int Processing result
+ */
+int rapidjson::check(::rapidjson::Value& jsonArray, std::string& strPath, const stSchema& schema, const stSchema::stRule& rule, const ::rapidjson::SizeType& uiBegin, const ::rapidjson::SizeType& uiEnd, const stCheckConfig& checkConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet, std::atomic<size_t>* pErrors)
+{
+    int          iRet     = 0;
+    const size_t ulLength = strPath.size();
+
+    // Loop over the items, while the error budget (shared by the workers) is not exhausted
+    for(::rapidjson::SizeType uiCnt = uiBegin; uiCnt < uiEnd; ++uiCnt)
+    { 
+        size_t ulErrors = (pErrors != nullptr)? pErrors->load(std::memory_order_relaxed): vecCheckRet.size();
+        if((limit(checkConfig) != 0) && 
+           (ulErrors >= limit(checkConfig)))
+        {
+            iRet = -1;
+            break;
+        }
+        size_t              ulReported = vecCheckRet.size();
+        ::rapidjson::Value& item       = jsonArray[uiCnt];
+        strPath.append("[").append(std::to_string(uiCnt)).append("]");
+        if(!item.IsObject())
+        {
+            vecCheckRet.push_back({strPath, CHECK_ERROR::BAD_FORMAT});
+            iRet = -1;
+        }
+        else if(check(item, strPath, schema, rule.uiFirstChild, rule.uiChildCount, checkConfig, vecCheckRet))
+        {
+            iRet = -1;
+        }
+        if(pErrors != nullptr)
+        {
+            pErrors->fetch_add(vecCheckRet.size() - ulReported, std::memory_order_relaxed);
+        }
+        strPath.resize(ulLength);
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief SAX handler validating a compiled schema while parsing
+ * 
+ * Each open container is a frame holding the expectations of its children:
+ * an expectation is a rule and the offset of its next path segment, matched
+ * by member name in an object or by element index in an array. The rules a
+ * value is the node of are checked when the value is read, missing nodes and
+ * empty arrays when their container ends. Parsing stops on the first
+ * violation.
+ */
+struct rapidjson::stSaxHandler
+{
+    /**
+     * @brief Expectation of a rule path segment
+     */
+    struct stExpect
+    {
+        uint32_t uiRule    {0};
+        uint32_t uiSegment {0};
+        uint32_t uiPath    {0};
+        bool     bElement  {false};
+        bool     bSeen     {false};
+    };
+
+    /**
+     * @brief Open container
+     */
+    struct stFrame
+    {
+        bool                  bArray  {false};
+        uint32_t              uiCount {0};
+        size_t                ulPaths {0};
+        std::vector<stExpect> vecExpect;
+        std::vector<stExpect> vecItems;
+        std::vector<stExpect> vecArrays;
+    };
+
+    rapidjson&                                          json;
+    const stSchema&                                     schema;
+    std::vector<std::pair<std::string, CHECK_ERROR>>&   vecCheckRet;
+    std::vector<stFrame>                                vecFrames;
+    std::vector<std::string>                            vecPaths;
+    std::vector<stExpect>                               vecSlot;
+    std::vector<stExpect>                               vecSlotItems;
+    std::string                                         strItemPath;
+    bool                                                bRoot {true};
+
+    stSaxHandler(rapidjson& jsonRef, const stSchema& schemaRef, std::vector<std::pair<std::string, CHECK_ERROR>>& vecRet):
+        json       {jsonRef},
+        schema     {schemaRef},
+        vecCheckRet{vecRet}
+    {
+        vecPaths.push_back("");
+    }
+
+    /**
+     * @brief Path of the node of a rule
+     */
+    std::string path(const stExpect& expect)
+    {
+        const std::string& strBase = vecPaths[expect.uiPath];
+        return strBase.empty()? schema.vecRules[expect.uiRule].strName: strBase + json.m_cNodePathSeparator + schema.vecRules[expect.uiRule].strName;
+    }
+
+    /**
+     * @brief Report a violation, stop parsing
+     */
+    bool fail(const std::string& strPath, const CHECK_ERROR& eError)
+    {
+        vecCheckRet.push_back({strPath, eError});
+        return false;
+    }
+
+    /**
+     * @brief Node of a rule does not exist
+     */
+    bool missing(const stExpect& expect)
+    {
+        return schema.vecRules[expect.uiRule].bOptional? true: fail(path(expect), CHECK_ERROR::MISSING_NODE);
+    }
+
+    /**
+     * @brief Resolve the expectations of the value being read
+     * 
+     * @param pValue Scalar value (nullptr for a container)
+     * @param bObject Value is an object
+     * @param bArray Value is an array
+     * @param frame Frame of the container value
+     */
+    bool value(::rapidjson::Value* pValue, const bool& bObject, const bool& bArray, stFrame& frame)
+    {
+        bool bRet = true;
+
+        if(bRoot)
+        {   // Root rules are members of the root object
+            bRoot = false;
+            for(uint32_t uiRule = 0; bRet && (uiRule < schema.uiRootCount); ++uiRule)
+            {
+                stExpect expect;
+                expect.uiRule = uiRule;
+                if(bObject)
+                {
+                    frame.vecExpect.push_back(expect);
+                }
+                else
+                {
+                    bRet = missing(expect);
+                }
+            }
+        }
+        // Items of an array of objects
+        for(size_t ulCnt = 0; bRet && (ulCnt < vecSlotItems.size()); ++ulCnt)
+        {
+            if(!bObject)
+            {
+                bRet = fail(strItemPath, CHECK_ERROR::BAD_FORMAT);
+            }
+            else
+            {
+                const stSchema::stRule& rule = schema.vecRules[vecSlotItems[ulCnt].uiRule];
+                vecPaths.push_back(strItemPath);
+                for(uint32_t uiRule = rule.uiFirstChild; uiRule < rule.uiFirstChild + rule.uiChildCount; ++uiRule)
+                {
+                    stExpect expect;
+                    expect.uiRule = uiRule;
+                    expect.uiPath = static_cast<uint32_t>(vecPaths.size() - 1);
+                    frame.vecExpect.push_back(expect);
+                }
+            }
+        }
+        // Rules reaching this value
+        for(size_t ulCnt = 0; bRet && (ulCnt < vecSlot.size()); ++ulCnt)
+        {
+            stExpect                 expect  = vecSlot[ulCnt];
+            const stSchema::stRule&  rule    = schema.vecRules[expect.uiRule];
+            const stPath::stSegment& segment = rule.path.vecSegments[expect.uiSegment];
+            if((segment.ulArrayElemnt != IS_OBJECT) && 
+               (!expect.bElement))
+            {   // Value must be an array holding the element
+                if(bArray)
+                {
+                    frame.vecExpect.push_back(expect);
+                }
+                else
+                {
+                    bRet = missing(expect);
+                }
+            }
+            else if(expect.uiSegment + 1 < rule.path.vecSegments.size())
+            {   // Value must be an object holding the next segment
+                if(bObject)
+                {
+                    expect.uiSegment++;
+                    expect.bElement = false;
+                    frame.vecExpect.push_back(expect);
+                }
+                else
+                {
+                    bRet = missing(expect);
+                }
+            }
+            else
+            {   // Value is the node of the rule
+                bRet = node(pValue, bObject, bArray, expect, frame);
+            }
+        }
+        vecSlot.clear();
+        vecSlotItems.clear();
+
+        // Return processing result
+        return bRet;
+    }
+
+    /**
+     * @brief Check the node of a rule
+     */
+    bool node(::rapidjson::Value* pValue, const bool& bObject, const bool& bArray, const stExpect& expect, stFrame& frame)
+    {
+        bool                    bRet  = true;
+        const stSchema::stRule& rule  = schema.vecRules[expect.uiRule];
+        TYPE                    eType = bObject? TYPE::OBJECT: (bArray? TYPE::ARRAY: json.type(*pValue));
+
+        if((pValue != nullptr) && 
+           (pValue->IsNull()))
+        {
+            bRet = rule.bNull? true: fail(path(expect), CHECK_ERROR::UNABLE_TO_GET);
+        }
+        else if(!(static_cast<uint16_t>(eType) & rule.usTypeMask))
+        {
+            bRet = fail(path(expect), CHECK_ERROR::BAD_FORMAT);
+        }
+        else if(rule.eType == TYPE::STRING)
+        {
+            bRet = ((pValue->GetStringLength() == 0) && (!rule.bEmpty))? fail(path(expect), CHECK_ERROR::BAD_VALUE): true;
+        }
+        else if((rule.eType == TYPE::OBJECT) && 
+                (rule.uiChildCount != 0))
+        {   // Children are members of this object
+            vecPaths.push_back(path(expect));
+            for(uint32_t uiRule = rule.uiFirstChild; uiRule < rule.uiFirstChild + rule.uiChildCount; ++uiRule)
+            {
+                stExpect child;
+                child.uiRule = uiRule;
+                child.uiPath = static_cast<uint32_t>(vecPaths.size() - 1);
+                frame.vecExpect.push_back(child);
+            }
+        }
+        else if(rule.eType == TYPE::ARRAY)
+        {   // Emptiness is known at the end of the array
+            stExpect array = expect;
+            vecPaths.push_back(path(expect));
+            array.uiPath   = static_cast<uint32_t>(vecPaths.size() - 1);
+            frame.vecArrays.push_back(array);
+            if(rule.uiChildCount != 0)
+            {
+                frame.vecItems.push_back(array);
+            }
+        }
+
+        // Return processing result
+        return bRet;
+    }
+
+    /**
+     * @brief Prepare the expectations of the next element of an array
+     */
+    void element()
+    {
+        if((!vecFrames.empty()) && 
+           (vecFrames.back().bArray))
+        {
+            stFrame&       frame   = vecFrames.back();
+            const uint32_t uiIndex = frame.uiCount++;
+            for(stExpect& expect: frame.vecExpect)
+            {
+                if((!expect.bSeen) && 
+                   (schema.vecRules[expect.uiRule].path.vecSegments[expect.uiSegment].ulArrayElemnt == uiIndex))
+                {
+                    expect.bSeen = true;
+                    stExpect slot = expect;
+                    slot.bElement = true;
+                    slot.bSeen    = false;
+                    vecSlot.push_back(slot);
+                }
+            }
+            if(!frame.vecItems.empty())
+            {
+                vecSlotItems = frame.vecItems;
+                strItemPath  = vecPaths[frame.vecItems.front().uiPath] + "[" + std::to_string(uiIndex) + "]";
+            }
+        }
+    }
+
+    /**
+     * @brief Scalar value
+     */
+    bool scalar(::rapidjson::Value&& scalarValue)
+    {
+        stFrame frame;
+        element();
+        return value(&scalarValue, false, false, frame);
+    }
+
+    /**
+     * @brief Container start
+     */
+    bool start(const bool& bArray)
+    {
+        stFrame frame;
+        element();
+        frame.bArray  = bArray;
+        frame.ulPaths = vecPaths.size();
+        bool bRet = value(nullptr, !bArray, bArray, frame);
+        vecFrames.push_back(std::move(frame));
+        return bRet;
+    }
+
+    /**
+     * @brief Container end
+     */
+    bool end()
+    {
+        bool     bRet  = true;
+        stFrame& frame = vecFrames.back();
+        // Expected children not found
+        for(size_t ulCnt = 0; bRet && (ulCnt < frame.vecExpect.size()); ++ulCnt)
+        {
+            if(!frame.vecExpect[ulCnt].bSeen)
+            {
+                bRet = missing(frame.vecExpect[ulCnt]);
+            }
+        }
+        // Empty arrays
+        for(size_t ulCnt = 0; bRet && (ulCnt < frame.vecArrays.size()); ++ulCnt)
+        {
+            if((frame.uiCount == 0) && 
+               (!schema.vecRules[frame.vecArrays[ulCnt].uiRule].bEmpty))
+            {
+                bRet = fail(vecPaths[frame.vecArrays[ulCnt].uiPath], CHECK_ERROR::EMPTY_ARRAY);
+            }
+        }
+        vecPaths.resize(frame.ulPaths);
+        vecFrames.pop_back();
+
+        // Return processing result
+        return bRet;
+    }
+
+    bool Null()                                                            { return scalar(::rapidjson::Value()); }
+    bool Bool(bool bValue)                                                 { return scalar(::rapidjson::Value(bValue)); }
+    bool Int(int iValue)                                                   { return scalar(::rapidjson::Value(iValue)); }
+    bool Uint(unsigned uiValue)                                            { return scalar(::rapidjson::Value(uiValue)); }
+    bool Int64(int64_t lValue)                                             { return scalar(::rapidjson::Value(lValue)); }
+    bool Uint64(uint64_t ulValue)                                          { return scalar(::rapidjson::Value(ulValue)); }
+    bool Double(double dValue)                                             { return scalar(::rapidjson::Value(dValue)); }
+    bool RawNumber(const char* pcValue, ::rapidjson::SizeType uiLength, bool)  { return scalar(::rapidjson::Value(::rapidjson::StringRef(pcValue, uiLength))); }
+    bool String(const char* pcValue, ::rapidjson::SizeType uiLength, bool)     { return scalar(::rapidjson::Value(::rapidjson::StringRef(pcValue, uiLength))); }
+    bool StartObject()                                                     { return start(false); }
+    bool EndObject(::rapidjson::SizeType)                                  { return end(); }
+    bool StartArray()                                                      { return start(true); }
+    bool EndArray(::rapidjson::SizeType)                                   { return end(); }
+
+    /**
+     * @brief Member name: the expectations it matches apply to its value
+     */
+    bool Key(const char* pcName, ::rapidjson::SizeType uiLength, bool)
+    {
+        for(stExpect& expect: vecFrames.back().vecExpect)
+        {
+            const stPath::stSegment& segment = schema.vecRules[expect.uiRule].path.vecSegments[expect.uiSegment];
+            if((!expect.bSeen) && 
+               (segment.uiLength == uiLength) && 
+               (memcmp(segment.strName.c_str(), pcName, uiLength) == 0))
+            {
+                expect.bSeen = true;
+                stExpect slot = expect;
+                slot.bSeen    = false;
+                vecSlot.push_back(slot);
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Validate a configuration string against a compiled schema while parsing it
+ * 
+ * @param strConfig Configuration string
+ * @param schema Compiled nodes configuration
+ * @param vecCheckRet Check result vector (first violation)
+ * @return int Processing result
+ */
+int rapidjson::stream(const std::string& strConfig, const stSchema& schema, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+{
+    int                     iRet = 0;
+    stSaxHandler            handler(*this, schema, vecCheckRet);
+    ::rapidjson::Reader     reader;
+    ::rapidjson::StringStream stringStream(strConfig.c_str());
+
+    if(!dispatch([&](auto flags) { return static_cast<bool>(reader.Parse<decltype(flags)::value>(stringStream, handler)); }))
+    {   // Violation (-2) or syntax error (-1)
+        iRet = vecCheckRet.empty()? -1: -2;
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Maximum number of errors of a check (0: no limit)
+ * 
+ * @param checkConfig Check execution configuration
+ * @return size_t Processing result
+ */
+size_t rapidjson::limit(const stCheckConfig& checkConfig)
+{
+    return checkConfig.bFailFast? 1: checkConfig.uiMaxErrors;
+}
+
+/**
+ * @brief Get the elemnts of specific node
+ * 
+ * @param strNode JSON node path 
+ * @return std::vector<std::string> vector of elements names
+ */
+std::vector<std::string> rapidjson::getElements(const std::string& strNode) const
+{
+    std::vector<std::string>  vecElements;
+    stPath                    path  = compile(strNode);
+    const ::rapidjson::Value* pNode = path.vecSegments.empty()? nullptr: node(path);
+
+    // Get the elemnts of the node if it is object and not empty
+    if((pNode != nullptr) && 
+       (pNode->IsObject()))
+    {
+        for(::rapidjson::Value::ConstMemberIterator itr = pNode->MemberBegin(); itr != pNode->MemberEnd(); itr++)
+        {
+            if(itr->name.IsString())
+            {
+                vecElements.push_back(itr->name.GetString());
+            }
+        }
+    }
+
+    // Return processing result (list of the elments in this node)
+    return vecElements;
+}
+
+/**
+ * @brief set / add object with datatype
+ * 
+ * @tparam T_TYPEA 
+ * @param memberName Json object member value
+ * @param tType data type
+ * @param jsonObject json array 
+ * @param eType typr of process
+ * @return int processing result
+ */
+template<typename T_TYPEA>
+int rapidjson::castData(::rapidjson::Value& memberName, const T_TYPEA& tType, ::rapidjson::Value& jsonObject, const stProcess::TYPE& eType)
+{
+    int                iRet = 0;
+    ::rapidjson::Value memberValue;
+
+    // Build the value with the setter of its own type
+    if constexpr (std::is_same<T_TYPEA, std::string>::value)
+    {   // set string
+        memberValue.SetString(tType.c_str(), static_cast<::rapidjson::SizeType>(tType.size()), m_allocator);
+    }
+    else if constexpr (std::is_same<T_TYPEA, bool>::value)
+    {   // set bool
+        memberValue.SetBool(tType);
+    }
+    else if constexpr (std::is_same<T_TYPEA, float>::value)
+    {   // set float
+        memberValue.SetFloat(tType);
+    }
+    else if constexpr (std::is_same<T_TYPEA, double>::value)
+    {   // set double
+        memberValue.SetDouble(tType);
+    }
+    else if constexpr (std::is_integral<T_TYPEA>::value && std::is_signed<T_TYPEA>::value)
+    {   // set signed int, up to 4 or 8 bytes
+        if constexpr (sizeof(T_TYPEA) <= 4)
+        {
+            memberValue.SetInt(tType);
+        }
+        else
+        {
+            memberValue.SetInt64(tType);
+        }
+    }
+    else if constexpr (std::is_integral<T_TYPEA>::value)
+    {   // set unsigned int, up to 4 or 8 bytes
+        if constexpr (sizeof(T_TYPEA) <= 4)
+        {
+            memberValue.SetUint(tType);
+        }
+        else
+        {
+            memberValue.SetUint64(tType);
+        }
+    }
+    else
+    {
+        iRet = -1;
+    }
+
+    if(!iRet)
+    {
+        switch (eType)
+        {
+            case stProcess::TYPE::SET:
+                jsonObject = memberValue;
+                break;
+            case stProcess::TYPE::PUSHBACK:
+                jsonObject.PushBack(memberValue, m_allocator);
+                break;
+            case stProcess::TYPE::ADD:
+                jsonObject.AddMember(memberName, memberValue, m_allocator);
+                break;
+
+            default:
+                iRet = -1;
+                break;
+        }
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Get the type of a specific node
+ * 
+ * @param jsonObject object of the json file
+ * @return JSON_TYPE type of node
+ */
+rapidjson::TYPE rapidjson::type(const ::rapidjson::Value& jsonObject) const
+{
+    rapidjson::TYPE eType = rapidjson::TYPE::UKNOWN;
+
+    // Get the type of the node 
+    switch (jsonObject.GetType())
+    {
+        case ::rapidjson::kArrayType:
+            eType = rapidjson::TYPE::ARRAY;
+            break;
+        case ::rapidjson::kObjectType:
+            eType = rapidjson::TYPE::OBJECT;
+            break;
+        case ::rapidjson::kTrueType:
+        case ::rapidjson::kFalseType:
+            eType = rapidjson::TYPE::BOOL;
+            break;
+        case ::rapidjson::kStringType:
+            eType = rapidjson::TYPE::STRING;
+            break;
+        case ::rapidjson::kNumberType:
+            if(jsonObject.IsInt())
+            {
+                eType = rapidjson::TYPE::SINT32;
+            }
+            else if (jsonObject.IsUint())
+            {
+                eType = rapidjson::TYPE::UINT32;
+            }
+            else if (jsonObject.IsInt64())
+            {
+                eType = rapidjson::TYPE::SINT64;
+            }
+            else if (jsonObject.IsUint64())
+            {
+                eType = rapidjson::TYPE::UINT64;
+            }
+            else if (jsonObject.IsFloat())
+            {
+                eType = rapidjson::TYPE::FLOAT;
+            }
+            else if (jsonObject.IsDouble())
+            {
+                eType = rapidjson::TYPE::DOUBLE;
+            }
+            
+            break;
+        
+        default:
+            break;
+    }
+
+    // Return processing result (node type)
+    return eType;
+
+}
+
+/**
+ * @brief Get the elemnt of a specific type
+ * @tparam T_VALUE 
+ * @param jsonObject object of the json file
+ * @param tValue Value to retrieve
+ * @return  int processing result
+ */
+template<typename T_VALUE>
+int rapidjson::element(const ::rapidjson::Value& jsonObject, T_VALUE& tValue) const
+{
+    int iRet = 0;
+
+    // Each instantiation only checks its own data type and range
+    if constexpr (std::is_same<T_VALUE, std::string>::value)
+    {   // Get string element
+        if(jsonObject.IsString())
+        {
+            tValue.assign(jsonObject.GetString(), jsonObject.GetStringLength());
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+    else if constexpr (std::is_same<T_VALUE, std::string_view>::value)
+    {   // Get string element as a view of the document
+        if(jsonObject.IsString())
+        {
+            tValue = std::string_view(jsonObject.GetString(), jsonObject.GetStringLength());
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+    else if constexpr (std::is_same<T_VALUE, bool>::value)
+    {   // Get bool element
+        if(jsonObject.IsBool())
+        {
+            tValue = jsonObject.GetBool();
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+    else if constexpr (std::is_floating_point<T_VALUE>::value)
+    {   // Get float / double element from any number (float: within its range)
+        if(jsonObject.IsNumber())
+        {
+            double dValue = jsonObject.GetDouble();
+            if constexpr (std::is_same<T_VALUE, float>::value)
+            {   // A finite double out of the float range can not be narrowed
+                if((std::isfinite(dValue)) && 
+                   (std::fabs(dValue) > std::numeric_limits<float>::max()))
+                {
+                    iRet = -2;
+                }
+            }
+            if(!iRet)
+            {
+                tValue = static_cast<T_VALUE>(dValue);
+            }
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+    else if constexpr (std::is_signed<T_VALUE>::value)
+    {   // Get signed int element within its range
+        if(jsonObject.IsInt64())
+        {
+            int64_t lValue = jsonObject.GetInt64();
+            if constexpr (sizeof(T_VALUE) < sizeof(int64_t))
+            {
+                if((lValue < std::numeric_limits<T_VALUE>::min()) || 
+                   (lValue > std::numeric_limits<T_VALUE>::max()))
+                {
+                    iRet = -2;
+                }
+            }
+            if(!iRet)
+            {
+                tValue = static_cast<T_VALUE>(lValue);
+            }
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+    else
+    {   // Get unsigned int element within its range
+        if(jsonObject.IsUint64())
+        {
+            uint64_t ulValue = jsonObject.GetUint64();
+            if constexpr (sizeof(T_VALUE) < sizeof(uint64_t))
+            {
+                if(ulValue > std::numeric_limits<T_VALUE>::max())
+                {
+                    iRet = -2;
+                }
+            }
+            if(!iRet)
+            {
+                tValue = static_cast<T_VALUE>(ulValue);
+            }
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+
+    if((iRet) && 
+       (!jsonObject.IsString()) && 
+       (!jsonObject.IsBool()) && 
+       (!jsonObject.IsNumber()))
+    {   // Not a data type node
+        iRet = -1;
+    }
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Get the vector of elements 
+ * 
+ * @tparam T_VALUE 
+ * @param vecValue data value
+ * @param strNodeFirst path of the node
+ * @return int processing result
+ */
+template<typename T_VALUE>
+int rapidjson::getVector(std::vector<T_VALUE>& vecValue, const std::string& strNodeFirst) const
+{   // Resolve the array once and convert its elements in a single pass
+    return getVector(vecValue, compile(strNodeFirst));
+}
+
+/**
+ * @brief Set the vector of elements 
+ * 
+ * @tparam T_VALUE 
+ * @param vecValue data value
+ * @param strNode path of the node
+ * @param eMode Array write mode
+ * @return int processing result
+ */
+template<typename T_VALUE>
+int rapidjson::setVector(const std::vector<T_VALUE>& vecValue, const std::string& strNode, const SET_MODE& eMode)
+{   // Resolve or create the array once and fill it in a single pass
+    return setVector(vecValue, compile(strNode), eMode);
+}
+
+/**
+ * @brief Set JSON object value based its compiled path
+ * 
+ * @tparam T_VALUE 
+ * @param jsonObject object of the json file
+ * @param tValue Value to set
+ * @param path Compiled JSON node path
+ * @return int Processing result
+ */
+template<typename T_VALUE>
+int rapidjson::set(::rapidjson::Value& jsonObject, const T_VALUE& tValue, const stPath& path)
+{
+    int                 iRet  = 0;
+    ::rapidjson::Value  memberName;
+    ::rapidjson::Value* pNode = create(jsonObject, path);
+
+    if(pNode != nullptr)
+    {   // Set the node value
+        iRet = castData(memberName, tValue, *pNode, stProcess::TYPE::SET);
+    }
+    else
+    {
+        iRet = -1;
+    }
+
+    // Processing result
+    return iRet;
+}
+
+/**
+ * @brief processing of JSON object value based its compiled path
+ * 
+ * @tparam T_VALUE 
+ * @param jsonObject object of the json file
+ * @param tValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @param eType Type of the proccess
+ * @return int processing result
+ */
+template<typename T_VALUE>
+int rapidjson::process(::rapidjson::Value& jsonObject, T_VALUE& tValue, const stPath& path, const stProcess::TYPE& eType)
+{
+    int                 iRet    = 0;
+    ::rapidjson::Value* pObject = &jsonObject;
+
+    // Check path
+    if(path.vecSegments.empty())
+    {
+        iRet = -1;
+    }
+    if(!iRet)
+    {   // Resolve the parent of the terminal node
+        for(size_t ulCnt = 0; (pObject != nullptr) && (ulCnt + 1 < path.vecSegments.size()); ++ulCnt)
+        {
+            pObject = find(*pObject, path.vecSegments[ulCnt]);
+        }
+        if((pObject == nullptr) || 
+           (!pObject->IsObject()))
+        {
+            iRet = -1;
+        }
+    }
+    if(!iRet)
+    {
+        const stPath::stSegment& segment = path.vecSegments.back();
+        // Resolve the terminal node
+        ::rapidjson::Value::MemberIterator itMember = member(*pObject, segment.strName.c_str(), segment.uiLength, segment.uiHash);
+        ::rapidjson::Value* pNode = find(*pObject, itMember, segment.ulArrayElemnt);
+        switch (eType)
+        {
+            case stProcess::TYPE::REMOVE:
+                if(pNode == nullptr)
+                {
+                    iRet = -1;
+                }
+                else if(segment.ulArrayElemnt == IS_OBJECT)
+                {   // Remove member
+                    indexRemove(*pObject, itMember);
+                    pObject->RemoveMember(itMember);
+                }
+                else
+                {   // Remove array element
+                    itMember->value.Erase(pNode);
+                }
+                break;
+            case stProcess::TYPE::GET:
+                iRet = (pNode != nullptr)? element(*pNode, tValue): -1;
+                break;
+            case stProcess::TYPE::EMPTY:
+                if((pNode == nullptr) || 
+                   (pNode->IsNull()))
+                {
+                    iRet = -1;
+                }
+                break;
+            case stProcess::TYPE::EXIST:
+                if(pNode == nullptr)
+                {
+                    iRet = -1;
+                }
+                break;
+            default:
+                iRet = -1;
+                break;
+        }
+    }
+
+    // Processing result
+    return iRet;
+}
+
+/**
+ * @brief Get the vector of elements 
+ * 
+ * @tparam T_VALUE 
+ * @param vecValue data value
+ * @param path Compiled JSON node path
+ * @return int processing result
+ */
+template<typename T_VALUE>
+int rapidjson::getVector(std::vector<T_VALUE>& vecValue, const stPath& path) const
+{
+    int                 iRet     = 0;
+    const ::rapidjson::Value* pNode    = node(path);
+    T_VALUE             tValue   {};
+    size_t              ulOffset = vecValue.size();
+
+    if constexpr (std::is_arithmetic<T_VALUE>::value && !std::is_same<T_VALUE, bool>::value)
+    {   // Numeric array: convert straight into the vector storage
+        if((pNode != nullptr) && 
+           (pNode->IsArray()))
+        {
+            vecValue.resize(ulOffset + pNode->Size());
+            iRet = convert(pNode->Begin(), pNode->Size(), vecValue.data() + ulOffset);
+        }
+    }
+    else if((pNode != nullptr) && 
+            (pNode->IsArray()))
+    {
+        vecValue.reserve(ulOffset + pNode->Size());
+        // Loop over all items
+        for(::rapidjson::Value::ConstValueIterator itElement = pNode->Begin(); itElement != pNode->End(); ++itElement)
+        {
+            iRet = element(*itElement, tValue);
+            if(iRet)
+            {
+                break;
+            }
+            // Add item to the list
+            vecValue.push_back(tValue);
+        }
+    }
+    if(iRet)
+    {   // Keep the values held before the call only
+        vecValue.resize(ulOffset);
+    }
+
+    // Return process
+    return iRet;
+}
+
+/**
+ * @brief Get the array elements into a contiguous buffer
+ * 
+ * @tparam T_VALUE 
+ * @param ptValues Buffer of the values
+ * @param ulSize Buffer size in, number of values out (required size on overflow)
+ * @param path Compiled JSON node path
+ * @return int processing result
+ */
+template<typename T_VALUE>
+int rapidjson::getBuffer(T_VALUE* ptValues, size_t& ulSize, const stPath& path) const
+{
+    int                 iRet  = 0;
+    const ::rapidjson::Value* pNode = node(path);
+
+    if((pNode == nullptr) || 
+       (!pNode->IsArray()))
+    {   // No array: no values
+        ulSize = 0;
+    }
+    else if(pNode->Size() > ulSize)
+    {   // Buffer too small: return the required size
+        ulSize = pNode->Size();
+        iRet   = -1;
+    }
+    else
+    {
+        iRet   = convert(pNode->Begin(), pNode->Size(), ptValues);
+        ulSize = iRet? 0: pNode->Size();
+    }
+
+    // Return process
+    return iRet;
+}
+
+/**
+ * @brief Convert numeric array elements into a contiguous buffer
+ * 
+ * Integers are gathered block by block into their widest type, then the block
+ * is range checked with a min/max reduction and narrowed into the buffer, so
+ * the type and range checks are done once per block instead of per element.
+ * 
+ * @tparam T_VALUE 
+ * @param pElements Array elements
+ * @param ulCount Number of elements
+ * @param ptValues Buffer of the values
+ * @return int processing result
+ */
+template<typename T_VALUE>
+int rapidjson::convert(const ::rapidjson::Value* pElements, const size_t& ulCount, T_VALUE* ptValues)
+{
+    int iRet = 0;
+
+    if constexpr (std::is_floating_point<T_VALUE>::value)
+    {
+        for(size_t ulCnt = 0; ulCnt < ulCount; ++ulCnt)
+        {
+            if(!pElements[ulCnt].IsNumber())
+            {
+                iRet = -2;
+                break;
+            }
+            double dValue = pElements[ulCnt].GetDouble();
+            if constexpr (std::is_same<T_VALUE, float>::value)
+            {   // A finite double out of the float range can not be narrowed
+                if((std::isfinite(dValue)) && 
+                   (std::fabs(dValue) > std::numeric_limits<float>::max()))
+                {
+                    iRet = -2;
+                    break;
+                }
+            }
+            ptValues[ulCnt] = static_cast<T_VALUE>(dValue);
+        }
+    }
+    else
+    {
+        typedef typename std::conditional<std::is_signed<T_VALUE>::value, int64_t, uint64_t>::type T_WIDE;
+        T_WIDE atValues[CONVERT_BLOCK_SIZE];
+
+        for(size_t ulBlock = 0; ulBlock < ulCount; ulBlock += CONVERT_BLOCK_SIZE)
+        {
+            const ::rapidjson::Value* pBlock   = pElements + ulBlock;
+            const size_t              ulLength = std::min<size_t>(CONVERT_BLOCK_SIZE, ulCount - ulBlock);
+            bool                      bValid   = true;
+            // Gather the block values, non integers read as 0
+            for(size_t ulCnt = 0; ulCnt < ulLength; ++ulCnt)
+            {
+                if constexpr (std::is_signed<T_VALUE>::value)
+                {
+                    bool bInteger   = pBlock[ulCnt].IsInt64();
+                    bValid         &= bInteger;
+                    atValues[ulCnt] = bInteger? pBlock[ulCnt].GetInt64(): 0;
+                }
+                else
+                {
+                    bool bInteger   = pBlock[ulCnt].IsUint64();
+                    bValid         &= bInteger;
+                    atValues[ulCnt] = bInteger? pBlock[ulCnt].GetUint64(): 0;
+                }
+            }
+            // Range check of the block
+            if constexpr (sizeof(T_VALUE) < sizeof(T_WIDE))
+            {
+                T_WIDE tMin = atValues[0];
+                T_WIDE tMax = atValues[0];
+                for(size_t ulCnt = 1; ulCnt < ulLength; ++ulCnt)
+                {
+                    tMin = std::min(tMin, atValues[ulCnt]);
+                    tMax = std::max(tMax, atValues[ulCnt]);
+                }
+                bValid &= (tMin >= static_cast<T_WIDE>(std::numeric_limits<T_VALUE>::min())) && 
+                          (tMax <= static_cast<T_WIDE>(std::numeric_limits<T_VALUE>::max()));
+            }
+            if(!bValid)
+            {
+                iRet = -2;
+                break;
+            }
+            // Narrow the block into the buffer
+            for(size_t ulCnt = 0; ulCnt < ulLength; ++ulCnt)
+            {
+                ptValues[ulBlock + ulCnt] = static_cast<T_VALUE>(atValues[ulCnt]);
+            }
+        }
+    }
+
+    // Return process
+    return iRet;
+}
+
+/**
+ * @brief Set the vector of elements 
+ * 
+ * REPLACE makes the node an array holding exactly the values, APPEND adds
+ * the values after the existing items of the array.
+ * 
+ * @tparam T_VALUE 
+ * @param vecValue data value
+ * @param path Compiled JSON node path
+ * @param eMode Array write mode
+ * @return int processing result
+ */
+template<typename T_VALUE>
+int rapidjson::setVector(const std::vector<T_VALUE>& vecValue, const stPath& path, const SET_MODE& eMode)
+{
+    int                 iRet  = 0;
+    ::rapidjson::Value  memberName;
+    ::rapidjson::Value* pNode = materialize()? nullptr: create(document(), path);
+
+    if(pNode != nullptr)
+    {
+        if(eMode == SET_MODE::REPLACE)
+        {   // Drop the current value
+            pNode->SetArray();
+        }
+        else if(pNode->IsNull())
+        {
+            pNode->SetArray();
+        }
+    }
+    if((pNode == nullptr) || 
+       (!pNode->IsArray()))
+    {
+        iRet = -1;
+    }
+    if(!iRet)
+    {   // Allocate the items once
+        pNode->Reserve(static_cast<::rapidjson::SizeType>(pNode->Size() + vecValue.size()), m_allocator);
+    }
+    // Loop over all items
+    for(size_t ulCnt = 0; (!iRet) && (ulCnt < vecValue.size()); ++ulCnt)
+    {
+        iRet = castData(memberName, vecValue[ulCnt], *pNode, stProcess::TYPE::PUSHBACK);
+    }
+
+    // Return process
+    return iRet;
+}
+
+/**
+ * @brief Find the child of an object based on a path segment
+ * 
+ * @param jsonObject object of the json file
+ * @param segment Compiled path segment
+ * @return ::rapidjson::Value* Child node (nullptr if not found)
+ */
+::rapidjson::Value* rapidjson::find(::rapidjson::Value& jsonObject, const stPath::stSegment& segment)
+{   // Same lookup on the mutable object
+    return const_cast<::rapidjson::Value*>(find(static_cast<const ::rapidjson::Value&>(jsonObject), segment));
+}
+
+/**
+ * @brief Find the child of an object based on a path segment
+ * 
+ * @param jsonObject object of the json file
+ * @param segment Compiled path segment
+ * @return const ::rapidjson::Value* Child node (nullptr if not found)
+ */
+const ::rapidjson::Value* rapidjson::find(const ::rapidjson::Value& jsonObject, const stPath::stSegment& segment) const
+{
+    const ::rapidjson::Value* pNode = nullptr;
+
+    if(jsonObject.IsObject())
+    {
+        pNode = find(jsonObject, member(jsonObject, segment.strName.c_str(), segment.uiLength, segment.uiHash), segment.ulArrayElemnt);
+    }
+
+    // Return processing result
+    return pNode;
+}
+
+/**
+ * @brief Find the member of an object based on its precomputed name hash
+ * 
+ * @param jsonObject object of the json file
+ * @param pcName member name
+ * @param ulLength member name length
+ * @param uiHash member name hash
+ * @return ::rapidjson::Value::MemberIterator Member (MemberEnd() if not found)
+ */
+::rapidjson::Value::MemberIterator rapidjson::member(::rapidjson::Value& jsonObject, const char* pcName, const size_t& ulLength, const uint32_t& uiHash)
+{   // Same lookup on the mutable object
+    return jsonObject.MemberBegin() + (member(static_cast<const ::rapidjson::Value&>(jsonObject), pcName, ulLength, uiHash) - jsonObject.MemberBegin());
+}
+
+/**
+ * @brief Find the member of an object based on its precomputed name hash
+ * 
+ * @param jsonObject object of the json file
+ * @param pcName member name
+ * @param ulLength member name length
+ * @param uiHash member name hash
+ * @return ::rapidjson::Value::ConstMemberIterator Member (MemberEnd() if not found)
+ */
+::rapidjson::Value::ConstMemberIterator rapidjson::member(const ::rapidjson::Value& jsonObject, const char* pcName, const size_t& ulLength, const uint32_t& uiHash) const
+{
+    ::rapidjson::Value::ConstMemberIterator itMember = jsonObject.MemberEnd();
+    const stMemberIndex*                    pIndex   = nullptr;
+
+    if((m_uiIndexThreshold != 0) && 
+       (jsonObject.MemberCount() >= m_uiIndexThreshold))
+    {
+        pIndex = indexGet(jsonObject);
+    }
+    if(pIndex == nullptr)
+    {   // Lookup member without copying its name
+        ::rapidjson::Value memberName(::rapidjson::StringRef(pcName, ulLength));
+        itMember = jsonObject.FindMember(memberName);
+    }
+    else
+    {   // Lookup the slots of the hash
+        auto pairSlots = pIndex->mapSlots.equal_range(uiHash);
+        for(auto itSlot = pairSlots.first; itSlot != pairSlots.second; ++itSlot)
+        {
+            const ::rapidjson::Value& name = jsonObject.MemberBegin()[itSlot->second].name;
+            if((name.GetStringLength() == ulLength) && 
+               (memcmp(name.GetString(), pcName, ulLength) == 0))
+            {
+                itMember = jsonObject.MemberBegin() + itSlot->second;
+                break;
+            }
+        }
+    }
+
+    // Return processing result
+    return itMember;
+}
+
+/**
+ * @brief Get the member index of an object
+ * 
+ * The indexes are only changed by the writers: no lock is taken. An index
+ * of a replaced or moved member array is not used.
+ * 
+ * @param jsonObject object of the json file
+ * @return const stMemberIndex* Member index (nullptr if not indexed or not valid)
+ */
+const rapidjson::stMemberIndex* rapidjson::indexGet(const ::rapidjson::Value& jsonObject) const
+{
+    const stMemberIndex* pIndex  = nullptr;
+    auto                 itIndex = m_mapIndexes.find(&jsonObject);
+
+    if((itIndex != m_mapIndexes.end()) && 
+       (itIndex->second.pMembers == &*jsonObject.MemberBegin()) && 
+       (itIndex->second.uiCount  == jsonObject.MemberCount()))
+    {
+        pIndex = &itIndex->second;
+    }
+
+    // Return processing result
+    return pIndex;
+}
+
+/**
+ * @brief Build the member index of an object
+ * 
+ * @param jsonObject object of the json file
+ */
+void rapidjson::indexMake(const ::rapidjson::Value& jsonObject) const
+{
+    stMemberIndex& memberIndex = m_mapIndexes[&jsonObject];
+    uint32_t       uiSlot      = 0;
+
+    memberIndex.mapSlots.clear();
+    memberIndex.mapSlots.reserve(jsonObject.MemberCount());
+    for(::rapidjson::Value::ConstMemberIterator itr = jsonObject.MemberBegin(); itr != jsonObject.MemberEnd(); ++itr, ++uiSlot)
+    {
+        memberIndex.mapSlots.emplace(hash(itr->name.GetString(), itr->name.GetStringLength()), uiSlot);
+    }
+    memberIndex.pMembers = &*jsonObject.MemberBegin();
+    memberIndex.uiCount  = jsonObject.MemberCount();
+}
+
+/**
+ * @brief Build the member indexes of the document (document reloaded)
+ * 
+ * Every object with at least the threshold member count is indexed, so the
+ * lookups never build an index. A lazy loaded document is indexed when it
+ * is parsed.
+ */
+void rapidjson::indexBuild() const
+{
+    std::vector<const ::rapidjson::Value*> vecValues;
+
+    m_mapIndexes.clear();
+    if(m_uiIndexThreshold != 0)
+    {
+        vecValues.push_back(&m_docJsonFile);
+    }
+    while(!vecValues.empty())
+    {
+        const ::rapidjson::Value* pValue = vecValues.back();
+        vecValues.pop_back();
+        if(pValue->IsObject())
+        {
+            if(pValue->MemberCount() >= m_uiIndexThreshold)
+            {
+                indexMake(*pValue);
+            }
+            for(::rapidjson::Value::ConstMemberIterator itr = pValue->MemberBegin(); itr != pValue->MemberEnd(); ++itr)
+            {
+                vecValues.push_back(&itr->value);
+            }
+        }
+        else if(pValue->IsArray())
+        {
+            for(::rapidjson::Value::ConstValueIterator itr = pValue->Begin(); itr != pValue->End(); ++itr)
+            {
+                vecValues.push_back(&*itr);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Update the member index of an object after a member was added
+ * 
+ * @param jsonObject object of the json file
+ */
+void rapidjson::indexAdd(::rapidjson::Value& jsonObject)
+{
+    // Writers have exclusive access: update the index in place
+    auto itIndex = m_mapIndexes.find(&jsonObject);
+
+    if((itIndex != m_mapIndexes.end()) && 
+       (itIndex->second.uiCount + 1 == jsonObject.MemberCount()))
+    {   // Index the last member, the member array may have been moved
+        stMemberIndex&            memberIndex = itIndex->second;
+        const ::rapidjson::Value& name        = (jsonObject.MemberEnd() - 1)->name;
+        memberIndex.mapSlots.emplace(hash(name.GetString(), name.GetStringLength()), memberIndex.uiCount);
+        memberIndex.pMembers = &*jsonObject.MemberBegin();
+        memberIndex.uiCount++;
+    }
+    else if((m_uiIndexThreshold != 0) && 
+            (jsonObject.MemberCount() >= m_uiIndexThreshold))
+    {   // Object grown to the threshold, or index not valid
+        indexMake(jsonObject);
+    }
+    else if(itIndex != m_mapIndexes.end())
+    {
+        m_mapIndexes.erase(itIndex);
+    }
+}
+
+/**
+ * @brief Update the member index of an object before a member is removed
+ * 
+ * RemoveMember() moves the last member into the slot of the removed one.
+ * 
+ * @param jsonObject object of the json file
+ * @param itMember Member to remove
+ */
+void rapidjson::indexRemove(::rapidjson::Value& jsonObject, const ::rapidjson::Value::MemberIterator& itMember)
+{
+    // Writers have exclusive access: update the index in place
+    auto itIndex = m_mapIndexes.find(&jsonObject);
+
+    if(itIndex != m_mapIndexes.end())
+    {
+        stMemberIndex& memberIndex = itIndex->second;
+        if((memberIndex.pMembers == &*jsonObject.MemberBegin()) && 
+           (memberIndex.uiCount  == jsonObject.MemberCount()))
+        {
+            uint32_t uiSlot = static_cast<uint32_t>(itMember - jsonObject.MemberBegin());
+            uint32_t uiLast = memberIndex.uiCount - 1;
+            // Remove the slot of the member
+            auto pairSlots = memberIndex.mapSlots.equal_range(hash(itMember->name.GetString(), itMember->name.GetStringLength()));
+            for(auto itSlot = pairSlots.first; itSlot != pairSlots.second; ++itSlot)
+            {
+                if(itSlot->second == uiSlot)
+                {
+                    memberIndex.mapSlots.erase(itSlot);
+                    break;
+                }
+            }
+            // Move the slot of the last member
+            if(uiSlot != uiLast)
+            {
+                const ::rapidjson::Value& name = jsonObject.MemberBegin()[uiLast].name;
+                pairSlots = memberIndex.mapSlots.equal_range(hash(name.GetString(), name.GetStringLength()));
+                for(auto itSlot = pairSlots.first; itSlot != pairSlots.second; ++itSlot)
+                {
+                    if(itSlot->second == uiLast)
+                    {
+                        itSlot->second = uiSlot;
+                        break;
+                    }
+                }
+            }
+            memberIndex.uiCount--;
+        }
+        else
+        {   // Index is not valid, the object is scanned
+            m_mapIndexes.erase(itIndex);
+        }
+    }
+}
+
+/**
+ * @brief Get the node of a resolved member
+ * 
+ * @param jsonObject object of the json file
+ * @param itMember Member of the object
+ * @param ulArrayElemnt the number of the array element
+ * @return ::rapidjson::Value* Node (nullptr if not found)
  */
-uint32_t rapidjson::size(const std::string& strNode)
+::rapidjson::Value* rapidjson::find(::rapidjson::Value& jsonObject, const ::rapidjson::Value::MemberIterator& itMember, const uint64_t& ulArrayElemnt)
 {
-    return size(m_docJsonFile, strNode);
+    ::rapidjson::Value* pNode = nullptr;
+
+    if(itMember != jsonObject.MemberEnd())
+    {
+        pNode = &itMember->value;
+        if(ulArrayElemnt != IS_OBJECT)
+        {   // Get array element
+            pNode = (pNode->IsArray() && (pNode->Size() > ulArrayElemnt))? &(*pNode)[static_cast<::rapidjson::SizeType>(ulArrayElemnt)]: nullptr;
+        }
+    }
+
+    // Return processing result
+    return pNode;
 }
 
 /**
- * @brief Check configuration
- *
- * @param strConfig Configuration string
- * @param mapNodes Nodes map
- * @param vecCheckRet Check result vector
- * @return int Processing result
+ * @brief Get the node of a resolved member
+ * 
+ * @param jsonObject object of the json file
+ * @param itMember Member of the object
+ * @param ulArrayElemnt the number of the array element
+ * @return const ::rapidjson::Value* Node (nullptr if not found)
  */
-int rapidjson::check(const std::string& strConfig, const std::map<std::string, stNodeConfig>& mapNodes, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+const ::rapidjson::Value* rapidjson::find(const ::rapidjson::Value& jsonObject, const ::rapidjson::Value::ConstMemberIterator& itMember, const uint64_t& ulArrayElemnt) const
 {
-    int iRet = 0;
-    // Initialization
-    vecCheckRet.clear();
-    
-    // Check if strConfig is empty
-    if(strConfig.empty())
-    { 
-        iRet = -1;
-    }
-    if(!iRet)
+    const ::rapidjson::Value* pNode = nullptr;
+
+    if(itMember != jsonObject.MemberEnd())
     {
-        // Load string configuration in a json object
-        iRet = set(strConfig);
+        pNode = &itMember->value;
+        if(ulArrayElemnt != IS_OBJECT)
+        {   // Get array element
+            pNode = (pNode->IsArray() && (pNode->Size() > ulArrayElemnt))? &(*pNode)[static_cast<::rapidjson::SizeType>(ulArrayElemnt)]: nullptr;
+        }
     }
-    if(!iRet)
+
+    // Return processing result
+    return pNode;
+}
+
+/**
+ * @brief Find a node based its compiled path
+ * 
+ * @param jsonObject object of the json file
+ * @param path Compiled JSON node path
+ * @return ::rapidjson::Value* Node (nullptr if not found)
+ */
+::rapidjson::Value* rapidjson::find(::rapidjson::Value& jsonObject, const stPath& path)
+{   // Same lookup on the mutable object
+    return const_cast<::rapidjson::Value*>(find(static_cast<const ::rapidjson::Value&>(jsonObject), path));
+}
+
+/**
+ * @brief Find a node based its compiled path
+ * 
+ * @param jsonObject object of the json file
+ * @param path Compiled JSON node path
+ * @return const ::rapidjson::Value* Node (nullptr if not found)
+ */
+const ::rapidjson::Value* rapidjson::find(const ::rapidjson::Value& jsonObject, const stPath& path) const
+{
+    const ::rapidjson::Value* pNode = path.vecSegments.empty()? nullptr: &jsonObject;
+
+    // Loop over all segments
+    for(size_t ulCnt = 0; (pNode != nullptr) && (ulCnt < path.vecSegments.size()); ++ulCnt)
     {
-        // Loop over all list items
-        for(const std::pair<std::string, stNodeConfig> &pairMapNodes: mapNodes)
-        {
-           // Get node 
-           const std::string&  strPath    = pairMapNodes.first;
-           const stNodeConfig& nodeConfig = pairMapNodes.second;
-           // Check node
-           iRet = check(strPath, nodeConfig, vecCheckRet);
-        }
-        // Check if Check result vector is empty
-        if(!vecCheckRet.empty())
-        {
-            iRet = -2;
-        }
+        pNode = find(*pNode, path.vecSegments[ulCnt]);
     }
 
     // Return processing result
-    return iRet;
+    return pNode;
 }
 
 /**
- * @brief Check node
+ * @brief Get JSON object value based its compiled path
  * 
- * @param strNode JSON node path
- * @param nodeConfig Node configuration 
- * @param vecCheckRet Check result vector
- * @return int Processing result
+ * @tparam T_VALUE 
+ * @param tValue Value to retrieve
+ * @param path Compiled JSON node path
+ * @return int processing result
  */
-int rapidjson::check(const std::string& strNode, const stNodeConfig& nodeConfig, std::vector<std::pair<std::string, CHECK_ERROR>>& vecCheckRet)
+template<typename T_VALUE>
+int rapidjson::getValue(T_VALUE& tValue, const stPath& path) const
 {
-    int         iRet    = 0;
-    std::string strPath = strNode; 
+    const ::rapidjson::Value* pNode = node(path);
+    // Processing result
+    return (pNode != nullptr)? element(*pNode, tValue): -1;
+}
 
-    // Check if node exist
-    if(exist(strPath))
-    {// Node exist
-        // Check if node is null 
-        if(!empty(strPath))
-        {// Node is not null 
-            // Check node type
-            if(!(static_cast<uint16_t>(getType(strPath)) & static_cast<uint16_t>(nodeConfig.eType)))
+/**
+ * @brief Find a node based its compiled path, create the missing nodes
+ * 
+ * This is the single write path of the string and compiled path setters: a
+ * null node on the path becomes an object, a missing array element is
+ * appended, any other type mismatch fails.
+ * 
+ * @param jsonObject object of the json file
+ * @param path Compiled JSON node path
+ * @return ::rapidjson::Value* Node (nullptr if it can not be created)
+ */
+::rapidjson::Value* rapidjson::create(::rapidjson::Value& jsonObject, const stPath& path)
+{   // Document is not modified while read only
+    ::rapidjson::Value* pNode = (m_bReadOnly || path.vecSegments.empty())? nullptr: &jsonObject;
+
+    // Loop over all segments
+    for(size_t ulCnt = 0; (pNode != nullptr) && (ulCnt < path.vecSegments.size()); ++ulCnt)
+    {
+        const stPath::stSegment& segment = path.vecSegments[ulCnt];
+        // Terminal node is created as null, intermediate nodes as objects
+        ::rapidjson::Type eChildType = (ulCnt + 1 < path.vecSegments.size())? ::rapidjson::kObjectType: ::rapidjson::kNullType;
+        if(pNode->IsNull())
+        {
+            pNode->SetObject();
+        }
+        if(!pNode->IsObject())
+        {
+            pNode = nullptr;
+            break;
+        }
+        ::rapidjson::Value::MemberIterator itMember = member(*pNode, segment.strName.c_str(), segment.uiLength, segment.uiHash);
+        if(itMember == pNode->MemberEnd())
+        {   // Add the member if it is not a member
+            ::rapidjson::Value memberName(segment.strName.c_str(), segment.uiLength, m_allocator);
+            ::rapidjson::Value childObject((segment.ulArrayElemnt == IS_OBJECT)? eChildType: ::rapidjson::kArrayType);
+            pNode->AddMember(memberName, childObject, m_allocator);
+            indexAdd(*pNode);
+            itMember = pNode->MemberEnd() - 1;
+        }
+        pNode = &itMember->value;
+        if(segment.ulArrayElemnt != IS_OBJECT)
+        {
+            if(!pNode->IsArray())
             {
-                // Set error
-                vecCheckRet.push_back({strPath, CHECK_ERROR::BAD_FORMAT});
-                iRet = -1;
+                pNode = nullptr;
+                break;
             }
-            // Check if Node is Empty (case: string/array)
-            if(!iRet)
-            {
-                // Switch node type
-                switch(nodeConfig.eType)
-                {
-                    // Case string node   
-                    case TYPE::STRING:
-                    {// Node is empty but should not be empty
-                        std::string strElement;
-                        if((!get(strElement, strPath)) && 
-                           (strElement.empty())        &&
-                           (!nodeConfig.bEmpty))
-                        {
-                            // set error
-                            vecCheckRet.push_back({strPath, CHECK_ERROR::BAD_VALUE});
-                            iRet = -1;
-                        }
-                        break;
-                    }
-                    // Case array node 
-                    case TYPE::ARRAY:
-                    {// Node is empty but should not be empty
-                        uint32_t uiSize = size(strPath);
-                        if((uiSize == 0) && 
-                           (!nodeConfig.bEmpty))
-                        {
-                            // Set error
-                            vecCheckRet.push_back({strPath, CHECK_ERROR::EMPTY_ARRAY});
-                            iRet = -1;
-                        }
-                        if((!iRet) &&
-                           (nodeConfig.mapNodeItems != nullptr))
-                        {
-                            int iRetItem = 0;
-                            // Loop over all items
-                            for(uint32_t uiCnt = 0; uiCnt < uiSize; ++uiCnt)
-                            { 
-                                strPath = strNode + "[" + std::to_string(uiCnt) + "]";
-
-                                if(getType(strPath) != TYPE::OBJECT)
-                                {
-                                    vecCheckRet.push_back({strPath, CHECK_ERROR::BAD_FORMAT});
-                                    iRetItem = -1;
-                                    iRet = -1;
-                                }
-                                if(!iRetItem)
-                                {
-                                    std::string strPathNodeItem = strPath; 
-                                    // Loop over all list items
-                                    for(const std::pair<std::string, stNodeConfig>& pairMapNodeItem: *nodeConfig.mapNodeItems)
-                                    {
-                                        // Get node 
-                                        const std::string& strNodeItem = pairMapNodeItem.first;
-                                        // Get node config
-                                        const stNodeConfig& nodeConfigItem = pairMapNodeItem.second;
-                                        // Check node items
-                                        strPathNodeItem = strPath + "." + strNodeItem;
-                                        iRet = check(strPathNodeItem, nodeConfigItem, vecCheckRet);
-                                    }
-                                }
-                                else
-                                {
-                                    // Reset iRetItem
-                                    iRetItem = 0;
-                                }
-                            }
-                        }
-                        break;
-                    }
-                    case TYPE::OBJECT:
-                    {
-                        if(nodeConfig.mapNodeItems != nullptr)
-                        {
-                            std::string strPathNodeItem = strPath; 
-                            // Loop over all list items
-                            for(const std::pair<std::string, stNodeConfig>& pairMapNodeItem: *nodeConfig.mapNodeItems)
-                            {
-                                // Get node 
-                                const std::string& strNodeItem = pairMapNodeItem.first;
-                                // Get node config
-                                const stNodeConfig& nodeConfigItem = pairMapNodeItem.second;
-                                // Check node items
-                                strPathNodeItem = strPath + "." + strNodeItem;
-                                iRet = check(strPathNodeItem, nodeConfigItem, vecCheckRet);
-                            }
-                        }
-                        break;
-                    }
-                    default: 
-                        break;
-                }
+            if(pNode->Size() > segment.ulArrayElemnt)
+            {   // Get existing element
+                pNode = &(*pNode)[static_cast<::rapidjson::SizeType>(segment.ulArrayElemnt)];
             }
-            if((!iRet) && 
-               (nodeConfig.callback != nullptr))
-            {
-                // Call the callback function
-                iRet = nodeConfig.callback(*this, strPath, vecCheckRet);
+            else
+            {   // Add element
+                ::rapidjson::Value childObject(eChildType);
+                pNode->PushBack(childObject, m_allocator);
+                pNode = &(*pNode)[pNode->Size() - 1];
             }
         }
-        else if((!nodeConfig.bNull))
-        {// Node is null but should not be null 
-            // Set error
-            vecCheckRet.push_back({strPath, CHECK_ERROR::UNABLE_TO_GET});
-            iRet = -1;
-        }   
     }
-    else if(!nodeConfig.bOptional)
-    {// Node dos not exist but mandatory
-        // Set error
-        vecCheckRet.push_back({strPath, CHECK_ERROR::MISSING_NODE});
-        iRet = -1;
+
+    // Return processing result
+    return pNode;
+}
+
+/**
+ * @brief Hash a node name (FNV-1a)
+ * 
+ * @param pcName node name
+ * @param ulLength node name length
+ * @return uint32_t hash of the name
+ */
+uint32_t rapidjson::hash(const char* pcName, const size_t& ulLength)
+{
+    uint32_t uiHash = 2166136261U;
+
+    for(size_t ulCnt = 0; ulCnt < ulLength; ++ulCnt)
+    {
+        uiHash ^= static_cast<uint8_t>(pcName[ulCnt]);
+        uiHash *= 16777619U;
     }
 
     // Return processing result
-    return iRet;
+    return uiHash;
 }
 
 /**
- * @brief Get the elemnts of specific node
+ * @brief Map and parse the json file in situ
  * 
- * @param strNode JSON node path 
- * @return std::vector<std::string> vector of elements names
+ * The file is mapped private (copy on write) over an anonymous reservation
+ * one byte larger than the file, so the parsed text is always terminated by
+ * a zero whether or not the file size is a multiple of the page size.
+ * On a parse error the document keeps its previous value, and so the
+ * previous mapping.
+ * 
+ * @param strFile JSON file path
+ * @return int processing result
  */
-std::vector<std::string> rapidjson::getElements(const std::string& strNode)
-{   // Processing result
-    return processList(m_docJsonFile, strNode);   
+int rapidjson::map(const std::string& strFile)
+{
+    int         iRet      = 0;
+    struct stat stFile    {};
+    void*       pvMapping = MAP_FAILED;
+    size_t      ulSize    = 0;
+    int         iFd       = open(strFile.c_str(), O_RDONLY);
+
+    if((iFd < 0) || 
+       (fstat(iFd, &stFile) != 0) || 
+       (stFile.st_size <= 0))
+    {
+        iRet = -1;
+    }
+    // Reserve the file size plus its terminating zero
+    if(!iRet)
+    {
+        ulSize    = static_cast<size_t>(stFile.st_size) + 1;
+        pvMapping = mmap(nullptr, ulSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        iRet      = (pvMapping == MAP_FAILED)? -1: 0;
+    }
+    // Map the file over the reservation
+    if((!iRet) && 
+       (mmap(pvMapping, static_cast<size_t>(stFile.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, iFd, 0) == MAP_FAILED))
+    {
+        iRet = -1;
+    }
+    if(iFd >= 0)
+    {   // The mapping stays valid once the file is closed
+        close(iFd);
+    }
+    // Parse in situ
+    if(!iRet)
+    {
+        madvise(pvMapping, ulSize, MADV_SEQUENTIAL);
+        iRet = dispatch([&](auto flags) { return !m_docJsonFile.ParseInsitu<decltype(flags)::value>(static_cast<char*>(pvMapping)).HasParseError(); })? 0: -1;
+        // Member indexes of the new document
+        indexBuild();
+    }
+    if(!iRet)
+    {   // Keep the new mapping, release the previous buffers
+        release();
+        m_pvMapping     = pvMapping;
+        m_ulMappingSize = ulSize;
+    }
+    else if(pvMapping != MAP_FAILED)
+    {
+        munmap(pvMapping, ulSize);
+    }
+
+    // Return processing result
+    return iRet;
 }
 
 /**
- * @brief Set JSON object value based its path
+ * @brief Flush a written file to the disk
  * 
- * @param jsonObject object of the json file
- * @param strValue Value to retrieve
- * @param strNode JSON node path
+ * @param iFile File descriptor
+ * @param eSync Synchronization mode
  * @return int Processing result
  */
-template<typename T_VALUE>
-int rapidjson::set(::rapidjson::Value& jsonObject, const T_VALUE& tValue, const std::string& strNode)
+inline int rapidjson::flush(const int& iFile, const stSaveConfig::SYNC& eSync)
 {
     int iRet = 0;
-    ::rapidjson::Document docJsonFile;
-    // Split path into 'node' & 'children'
-    std::string strNodePath;
-    std::string strChildren;
-    uint64_t ulArrayElemnt = 0;
-    split(strNode, strNodePath, strChildren, ulArrayElemnt);
-    // Check node name
-    if(strNodePath.empty())
+    if(eSync == stSaveConfig::SYNC::DATA)
     {
-        iRet = -1;
+        iRet = fdatasync(iFile);
     }
-    // 
-    if(!iRet)
-    {   
-        ::rapidjson::Value memberName(strNodePath.c_str(), strNodePath.size(), m_allocator);
-        // Process node
-        if(strChildren.empty())
-        {// Node has no childs (Terminal node)
-            // check if is the object exist or not
-            ::rapidjson::Document childDocJsonFile;
-            if (jsonObject.ObjectEmpty() || jsonObject.IsNull())
-            {   // add the object
-                if (ulArrayElemnt == IS_OBJECT)
-                {
-                    jsonObject.SetObject();
-                    iRet = castData(memberName, tValue, jsonObject,stProcess::TYPE::ADD);
-                }
-                else
-                {
-                    ::rapidjson::Value arrchildObject(::rapidjson::kArrayType);
-                    iRet = castData(memberName, tValue, jsonObject,stProcess::TYPE::PUSHBACK);
-                    jsonObject.AddMember(memberName, arrchildObject, m_allocator);
-                }
-            }
-            else
-            {// check if this object is a member or not
-                if (jsonObject.HasMember(strNodePath.c_str()))
-                {   // Set the object
-                    if (ulArrayElemnt == IS_OBJECT)
-                    {
-                        ::rapidjson::Value& childObject = jsonObject[strNodePath.c_str()];
-                        iRet = castData(memberName, tValue, childObject,stProcess::TYPE::SET);
-                    }
-                    else
-                    {   
-                        if (jsonObject[strNodePath.c_str()].Size() > ulArrayElemnt)
-                        {
-                            ::rapidjson::Value& childObject = jsonObject[strNodePath.c_str()][ulArrayElemnt];
-                            iRet = castData(memberName, tValue, childObject,stProcess::TYPE::SET);
-                        }
-                        else
-                        {
-                            ::rapidjson::Value& childObject = jsonObject[strNodePath.c_str()];
-                            iRet = castData(memberName, tValue, childObject,stProcess::TYPE::PUSHBACK);
-                        }
-                    } 
-                }
-                else
-                {   // add the object if it is not a member
-                    if (ulArrayElemnt == IS_OBJECT)
-                    {
-                        childDocJsonFile.SetObject();
-                        iRet = castData(memberName, tValue, jsonObject,stProcess::TYPE::ADD);
-                    }
-                    else
-                    {
-                        ::rapidjson::Value arrchildObject(::rapidjson::kArrayType);
-                        iRet = castData(memberName, tValue, arrchildObject,stProcess::TYPE::PUSHBACK);
-                        jsonObject.AddMember(memberName,arrchildObject, m_allocator);
-                    }
-                }  
-            }
+    else if(eSync == stSaveConfig::SYNC::FULL)
+    {
+        iRet = fsync(iFile);
+    }
+
+    // Return processing result
+    return (iRet == 0)? 0: -1;
+}
+
+/**
+ * @brief Release the buffers referenced by the document (mapping, in situ data)
+ */
+void rapidjson::release()
+{
+    if(m_pvMapping != nullptr)
+    {
+        munmap(m_pvMapping, m_ulMappingSize);
+        m_pvMapping     = nullptr;
+        m_ulMappingSize = 0;
+    }
+    m_pstrBuffer.reset();
+    std::vector<char>().swap(m_vecBuffer);
+    // The document no longer comes from a lazy load
+    m_bLazy = false;
+    m_pLazy.reset();
+}
+
+/**
+ * @brief Raw text, brackets index and parsed nodes of a lazy load
+ * 
+ * The offsets of the opening brackets are recorded in text order with the
+ * offsets of their closing brackets, so a container is skipped with a binary
+ * search. A node is located by walking the members (elements) of each level
+ * of its path, and only its value is parsed; the parsed values are kept
+ * (never moved) and share one allocator.
+ */
+struct rapidjson::stLazy
+{
+    static constexpr uint64_t NOT_FOUND = UINT64_MAX;
+
+    const char*                                              pcText  {nullptr};
+    size_t                                                   ulSize  {0};
+    uint64_t                                                 ulRoot  {0};
+    bool                                                     bInvalid {false};
+    std::vector<uint64_t>                                    vecOpen;
+    std::vector<uint64_t>                                    vecClose;
+    ::rapidjson::MemoryPoolAllocator<>                       allocator;
+    ::rapidjson::Document                                    docParser {&allocator};
+    std::deque<::rapidjson::Value>                           deqNodes;
+    std::unordered_map<uint64_t, const ::rapidjson::Value*>  mapNodes;
+
+    ~stLazy()
+    {
+        if(pcText != nullptr)
+        {
+            munmap(const_cast<char*>(pcText), ulSize);
         }
-        else
-        {// Node has children
-            if (jsonObject.ObjectEmpty() || jsonObject.IsNull())
-            {  // If the children is emty set the object and vlaue
-                if (ulArrayElemnt == IS_OBJECT)
-                {
-                    m_childDocJsonFile.SetObject();
-                    ::rapidjson::Value childObject(::rapidjson::kObjectType);
-                    iRet = set(childObject, tValue, strChildren);
-                    jsonObject.AddMember(memberName, childObject, m_childDocJsonFile.GetAllocator());
-                }
-                else
-                {
-                    m_childDocJsonFile.SetObject();
-                    ::rapidjson::Value member(strNodePath.c_str(), strNodePath.size(),m_childDocJsonFile.GetAllocator());
-                    ::rapidjson::Value childObject(::rapidjson::kObjectType);
-                    iRet = set(childObject, tValue, strChildren);
-                    ::rapidjson::Value arrchildObject(::rapidjson::kArrayType);
-                    arrchildObject.PushBack(childObject, m_childDocJsonFile.GetAllocator());
-                    jsonObject.AddMember(member,arrchildObject, m_childDocJsonFile.GetAllocator());
-                }
-            }
-            else
+    }
+
+    // Offset after the closing quote of the string at ulPos (ulSize + 1 if not terminated)
+    uint64_t quote(const uint64_t& ulPos) const
+    {
+        const char* pcBegin = pcText + ulPos + 1;
+        const char* pcEnd   = pcText + ulSize;
+        for(const char* pcQuote = pcBegin; pcQuote < pcEnd; ++pcQuote)
+        {
+            pcQuote = static_cast<const char*>(memchr(pcQuote, '"', pcEnd - pcQuote));
+            if(pcQuote == nullptr)
             {
-                if (ulArrayElemnt == IS_OBJECT)
-                {
-                    if (jsonObject.HasMember(strNodePath.c_str()))
-                    {   // Set the chilf id the object is member
-                        ::rapidjson::Value& childObject = jsonObject[strNodePath.c_str()];
-                        if (childObject.IsObject())
-                        {
-                            iRet = set(childObject, tValue, strChildren);
-                        }
-                        else
-                        {
-                            iRet = -1;
-                        }    
-                    }
-                    else
-                    {   // add the object if it is not a member
-                        m_childDocJsonFile.SetObject();
-                        ::rapidjson::Value childObject(::rapidjson::kObjectType);
-                        iRet = set(childObject, tValue, strChildren);
-                        jsonObject.AddMember(memberName, childObject, m_allocator);
-                    } 
-                }
-                else
-                {
-                    if (jsonObject.HasMember(strNodePath.c_str()))
-                    {   // Set the chilf id the object is member
-                        if (jsonObject[strNodePath.c_str()].Size() > ulArrayElemnt)
-                        {
-                            ::rapidjson::Value& childObject = jsonObject[strNodePath.c_str()][ulArrayElemnt];
-                            if (childObject.IsObject())
-                            {
-                                iRet = set(childObject, tValue, strChildren);
-                            }
-                            else
-                            {
-                                iRet = -1;
-                            }
-                        }
-                        else
-                        {
-                            ::rapidjson::Value& arrchildObject = jsonObject[strNodePath.c_str()];
-                            if (arrchildObject.IsArray() )
-                            { 
-                                ::rapidjson::Value childObject(::rapidjson::kObjectType);
-                                iRet = set(childObject, tValue, strChildren);
-                                arrchildObject.PushBack(childObject , m_allocator);
-                            }
-                            else 
-                            {
-                                iRet = -1;
-                            }
-                        }   
-                    }
-                    else
-                    {   // add the object if it is not a member
-                        m_childDocJsonFile.SetObject();
-                        ::rapidjson::Value member(strNodePath.c_str(), strNodePath.size(),m_childDocJsonFile.GetAllocator());
-                        ::rapidjson::Value childObject(::rapidjson::kObjectType);
-                        iRet = set(childObject, tValue, strChildren);
-                        ::rapidjson::Value arrchildObject(::rapidjson::kArrayType);
-                        arrchildObject.PushBack(childObject,m_childDocJsonFile.GetAllocator());
-                        jsonObject.AddMember(member,arrchildObject, m_allocator);
-                    } 
-                }
+                break;
+            }
+            // The quote is escaped by an odd number of backslashes
+            const char* pcEscape = pcQuote;
+            while((pcEscape > pcBegin) && 
+                  (pcEscape[-1] == '\\'))
+            {
+                --pcEscape;
+            }
+            if(((pcQuote - pcEscape) & 1) == 0)
+            {
+                return static_cast<uint64_t>(pcQuote - pcText) + 1;
             }
         }
+        return ulSize + 1;
     }
 
-    // Processing result
-    return iRet;
-}
-
-/**
- * @brief Get the Size object
- * 
- * @param jsonObject object of the json file
- * @param strNode Value to retrieve
- * @return uint32_t processing result
- */
-uint32_t rapidjson::size(::rapidjson::Value& jsonObject, const std::string& strNode)
-{
-    uint32_t uiRet = 0;
-    // Split path into 'node' & 'children'
-    std::string strNodePath;
-    std::string strChildren;
-    uint64_t ulArrayElemnt = 0;
-    split(strNode, strNodePath, strChildren, ulArrayElemnt);
-
-    // Check node name
-    if(strNodePath.empty())
-    {
-        uiRet = 0;
-    }
-    // 
-    if(!uiRet)
-    {   
-        ::rapidjson::Value memberName(strNodePath.c_str(), strNodePath.size(), m_allocator);
-        // Process node
-        if(strChildren.empty())
-        {// Node has no childs (Terminal node)
-            // check if the object is empty
-            if (jsonObject.ObjectEmpty() || jsonObject.IsNull() )
-            {   
-                uiRet = 0;
-            }
-            else
-            {   // check if has member 
-                if (jsonObject.HasMember(strNodePath.c_str()) )
-                {    
-                    if (jsonObject[strNodePath.c_str()].IsArray())
-                    {  
-                        uiRet = jsonObject[strNodePath.c_str()].Size();
-                    }
-                    else
-                    {
-                        uiRet = 0;
+    // Offset of the first non white space character from ulPos
+    uint64_t space(uint64_t ulPos) const
+    {
+        while((ulPos < ulSize) && 
+              ((pcText[ulPos] == ' ') || (pcText[ulPos] == '\t') || (pcText[ulPos] == '\n') || (pcText[ulPos] == '\r')))
+        {
+            ++ulPos;
+        }
+        return ulPos;
+    }
 
-                    } 
+    // Index the brackets, check that they match (texts of 4 GB and more)
+    int index()
+    {
+        std::vector<size_t> vecStack;
+        for(uint64_t ulPos = 0; ulPos < ulSize; ++ulPos)
+        {
+            char cData = pcText[ulPos];
+            if(cData == '"')
+            {
+                ulPos = quote(ulPos);
+                if(ulPos > ulSize)
+                {
+                    return -1;
                 }
-                else
-                {   // object not existing
-                    uiRet = 0;
-                } 
+                --ulPos;
             }
-        }
-        else
-        {// Node has children
-            if (jsonObject.ObjectEmpty() || jsonObject.IsNull())
-            {  
-                uiRet = 0;
+            else if((cData == '{') || 
+                    (cData == '['))
+            {
+                vecStack.push_back(vecOpen.size());
+                vecOpen.push_back(ulPos);
+                vecClose.push_back(0);
             }
-            else
+            else if((cData == '}') || 
+                    (cData == ']'))
             {
-                if (jsonObject.HasMember(strNodePath.c_str()))
+                if(vecStack.empty() || 
+                   (pcText[vecOpen[vecStack.back()]] != ((cData == '}')? '{': '[')))
                 {
-                    if (jsonObject[strNodePath.c_str()].IsArray())
-                    {   // Get the object if exist
-                        ::rapidjson::Value& childObject = jsonObject[strNodePath.c_str()][ulArrayElemnt];
-                        uiRet = size(childObject, strChildren);
-                    }
-                    else
-                    {   // Object not exists
-                        ::rapidjson::Value& childObject = jsonObject[strNodePath.c_str()];
-                        uiRet = size(childObject, strChildren);
-                    }
+                    return -1;
                 }
-                else
-                {
-                    uiRet = 0;
-
-                }  
+                vecClose[vecStack.back()] = ulPos;
+                vecStack.pop_back();
             }
         }
+        return vecStack.empty()? 0: -1;
     }
 
-    // Processing result
-    return uiRet;
-}
+    // Check the single root value of the indexed text
+    int root()
+    {
+        ulRoot = space(0);
+        return ((ulRoot < ulSize) && (space(end(ulRoot)) == ulSize))? 0: -1;
+    }
 
-/**
- * @brief processing of JSON object value based its path
- * 
- * @tparam T_VALUE 
- * @param jsonObject object of the json file
- * @param tValue Value to retrieve
- * @param strNode JSON node path
- * @param eType Type of the proccess
- * @return int rocessing result
- */
-template<typename T_VALUE>
-int rapidjson::process(::rapidjson::Value& jsonObject, T_VALUE& tValue, const std::string& strNode, const stProcess::TYPE& eType)
-{
-    int iRet = 0;
-    bool bRet = true;
-    // Split path into 'node' & 'children'
-    std::string strNodePath;
-    std::string strChildren;
-    uint64_t ulArrayElemnt = 0;
-    split(strNode, strNodePath, strChildren, ulArrayElemnt);
-    // Check node name
-    if(strNodePath.empty())
+    // Offset after the value at ulPos
+    uint64_t end(uint64_t ulPos) const
     {
-        iRet = -1;
+        char cData = pcText[ulPos];
+        if((cData == '{') || 
+           (cData == '['))
+        {
+            size_t ulIndex = std::lower_bound(vecOpen.begin(), vecOpen.end(), ulPos) - vecOpen.begin();
+            return vecClose[ulIndex] + 1;
+        }
+        if(cData == '"')
+        {
+            return quote(ulPos);
+        }
+        // Scalar
+        while((ulPos < ulSize) && 
+              (strchr(",}] \t\n\r", pcText[ulPos]) == nullptr))
+        {
+            ++ulPos;
+        }
+        return ulPos;
     }
-    // 
-    if(!iRet)
-    {   
-        ::rapidjson::Value memberName(strNodePath.c_str(), strNodePath.size(), m_allocator);
-        // Process node
-        if(strChildren.empty())
-        {// Node has no childs (Terminal node)
-            //check if it is an empty object or null object
-            if(jsonObject.ObjectEmpty() || jsonObject.IsNull())
-            {   
-                iRet = -1;
+
+    // The key string [ulBegin, ulEnd) (quotes included) is the segment name
+    bool key(const uint64_t& ulBegin, const uint64_t& ulEnd, const stPath::stSegment& segment) const
+    {
+        const char* pcKey    = pcText + ulBegin + 1;
+        size_t      ulLength = ulEnd - ulBegin - 2;
+        if(memchr(pcKey, '\\', ulLength) == nullptr)
+        {
+            return (ulLength == segment.uiLength) && 
+                   (memcmp(pcKey, segment.strName.data(), ulLength) == 0);
+        }
+        // Escaped key
+        ::rapidjson::Document docKey;
+        return (!docKey.Parse(pcText + ulBegin, ulEnd - ulBegin).HasParseError()) && 
+               (docKey.GetStringLength() == segment.uiLength) && 
+               (memcmp(docKey.GetString(), segment.strName.data(), segment.uiLength) == 0);
+    }
+
+    // Offset of the value of the member of the object at ulPos (first match)
+    uint64_t member(uint64_t ulPos, const stPath::stSegment& segment) const
+    {
+        ulPos = space(ulPos + 1);
+        while((ulPos < ulSize) && 
+              (pcText[ulPos] == '"'))
+        {
+            uint64_t ulKeyEnd = quote(ulPos);
+            bool     bMatch   = key(ulPos, ulKeyEnd, segment);
+            ulPos = space(ulKeyEnd);
+            if((ulPos >= ulSize) || 
+               (pcText[ulPos] != ':'))
+            {
+                break;
             }
-            else
+            ulPos = space(ulPos + 1);
+            if(bMatch)
             {
-                if (jsonObject.HasMember(strNodePath.c_str()))
-                {   // Remove member  
-                    switch (eType)
-                    {
-                        case stProcess::TYPE::REMOVE:
-                            if (ulArrayElemnt == IS_OBJECT)
-                            {
-                                bRet = jsonObject.RemoveMember(memberName);
-                            }
-                            else
-                            {
-                                bRet = jsonObject[ulArrayElemnt].RemoveMember(strNodePath.c_str());
-                            }
-                            if (bRet == false)
-                            {   // Error in reming member
-                                iRet = -1;
-                            } 
-                            break;
-                        case stProcess::TYPE::GET:
-                            iRet = getElement<T_VALUE>(tValue, jsonObject[strNodePath.c_str()], ulArrayElemnt);
-                            break;
-                        case stProcess::TYPE::EMPTY:
-                            if (jsonObject[strNodePath.c_str()].IsNull())
-                            {   // Error in reming member
-                                iRet = -1;
-                            } 
-                            break;
-                        case stProcess::TYPE::EXIST:
-                            break;
-                        default:
-                            iRet = -1;
-                            break;
-                    } 
-                }
-                else
-                {   // Has not member 
-                    iRet = -1;
-                } 
+                return ulPos;
+            }
+            ulPos = space(end(ulPos));
+            if((ulPos >= ulSize) || 
+               (pcText[ulPos] != ','))
+            {
+                break;
             }
+            ulPos = space(ulPos + 1);
         }
-        else
-        {// Node has children
-            if(jsonObject.ObjectEmpty() || jsonObject.IsNull())
-            {  
-                iRet = -1; 
+        return NOT_FOUND;
+    }
+
+    // Offset of the element of the array at ulPos
+    uint64_t element(uint64_t ulPos, const uint64_t& ulArrayElemnt) const
+    {
+        ulPos = space(ulPos + 1);
+        if((ulPos >= ulSize) || 
+           (pcText[ulPos] == ']'))
+        {
+            return NOT_FOUND;
+        }
+        for(uint64_t ulCnt = 0; ulCnt < ulArrayElemnt; ++ulCnt)
+        {
+            ulPos = space(end(ulPos));
+            if((ulPos >= ulSize) || 
+               (pcText[ulPos] != ','))
+            {
+                return NOT_FOUND;
             }
-            else
-            {  
-                if (jsonObject.HasMember(strNodePath.c_str()))
-                { // Remove existing member object
-                    if (ulArrayElemnt == IS_OBJECT)
-                    {   
-                        iRet = process(jsonObject[strNodePath.c_str()],tValue, strChildren, eType);
-                    }
-                    else
-                    { 
-                        iRet = process(jsonObject[strNodePath.c_str()][ulArrayElemnt], tValue, strChildren, eType);  
-                    }
-                }
-                else
-                {   // Not existing object to remove
-                    iRet = -1;
-                }  
+            ulPos = space(ulPos + 1);
+        }
+        return (ulPos < ulSize)? ulPos: NOT_FOUND;
+    }
+
+    // Offset of the value of a compiled path
+    uint64_t find(const stPath& path) const
+    {
+        uint64_t ulPos = path.vecSegments.empty()? NOT_FOUND: ulRoot;
+        for(size_t ulCnt = 0; (ulPos != NOT_FOUND) && (ulCnt < path.vecSegments.size()); ++ulCnt)
+        {
+            const stPath::stSegment& segment = path.vecSegments[ulCnt];
+            ulPos = (pcText[ulPos] == '{')? member(ulPos, segment): NOT_FOUND;
+            if((ulPos != NOT_FOUND) && 
+               (segment.ulArrayElemnt != IS_OBJECT))
+            {
+                ulPos = (pcText[ulPos] == '[')? element(ulPos, segment.ulArrayElemnt): NOT_FOUND;
             }
         }
+        return ulPos;
     }
 
-    // Processing result
-    return iRet;
-}
+    // The value at ulPos is parsed already (pNode: its value, nullptr if it is not valid)
+    bool cached(const uint64_t& ulPos, const ::rapidjson::Value*& pNode) const
+    {
+        auto itNode = mapNodes.find(ulPos);
+        if(itNode == mapNodes.end())
+        {
+            return false;
+        }
+        pNode = itNode->second;
+        return true;
+    }
+
+    // Parsed value at ulPos (nullptr if it is not valid), parse(docParser, pcText, ulLength) parses the text
+    template<typename tParse>
+    const ::rapidjson::Value* value(const uint64_t& ulPos, tParse&& parse)
+    {
+        auto itNode = mapNodes.find(ulPos);
+        if(itNode != mapNodes.end())
+        {
+            return itNode->second;
+        }
+        const ::rapidjson::Value* pNode = nullptr;
+        if(parse(docParser, pcText + ulPos, end(ulPos) - ulPos))
+        {
+            deqNodes.emplace_back();
+            deqNodes.back().Swap(docParser);
+            pNode = &deqNodes.back();
+        }
+        mapNodes.emplace(ulPos, pNode);
+        return pNode;
+    }
+};
 
 /**
- * @brief processing of JSON object value based its path
+ * @brief Parse json data with the SIMD front-end
  * 
- * @param jsonObject object of the json file
- * @param strNode JSON node path
- * @return TYPE type of node
+ * @param pcData JSON data
+ * @param ulSize JSON data length
+ * @return int processing result
  */
-rapidjson::TYPE rapidjson::process(::rapidjson::Value& jsonObject, const std::string& strNode)
+inline int rapidjson::scan(const char* pcData, const size_t& ulSize)
 {
-    std::string strNodePath;
-    std::string strChildren;
-    uint64_t ulArrayElemnt = 0;
-    split(strNode, strNodePath, strChildren, ulArrayElemnt);
-
-    int iExist = 0;
-    rapidjson::TYPE eType = rapidjson::TYPE::UKNOWN;
-
-    if(strChildren.empty()  && !process(jsonObject,iExist,strNode, stProcess::TYPE::EXIST))
-    {   
-        if (ulArrayElemnt == IS_OBJECT)
-        { 
-            eType = type(jsonObject[strNodePath.c_str()]);
-        }
-        else
-        {
-            eType = type(jsonObject[strNodePath.c_str()][ulArrayElemnt]); 
-        }  
+    if(m_bReadOnly)
+    {
+        return -1;
     }
-    else if (!strNodePath.empty() && !process(jsonObject,iExist,strNode, stProcess::TYPE::EXIST))
-    { 
-        if (ulArrayElemnt == IS_OBJECT)
-        {   // Process if is object      
-            eType = process(jsonObject[strNodePath.c_str()],strChildren);
-        }
-        else
-        {   // Process if is array 
-            eType = process(jsonObject[strNodePath.c_str()][ulArrayElemnt],strChildren);
-        }   
+    if(!m_pScanner)
+    {
+        m_pScanner.reset(new scanner());
     }
-    // Return processing result (type of the node)
-    return eType;
+    int iRet = m_pScanner->parse(m_docJsonFile, pcData, ulSize);
+    // Member indexes of the new document
+    indexBuild();
+    if(!iRet)
+    {   // The document no longer references the owned buffers
+        release();
+    }
+    // Return processing result
+    return iRet;
 }
 
 /**
- * @brief processing of JSON object value based its path
+ * @brief Parse the json file with the SIMD front-end
  * 
- * @param jsonObject object of the json file
- * @param strNode JSON node path
- * @return std::vector<std::string> list of elemnts
+ * The file is mapped read only for the parse, the document copies its strings.
+ * 
+ * @param strFile JSON file path
+ * @return int processing result
  */
-std::vector<std::string> rapidjson::processList(::rapidjson::Value& jsonObject, const std::string& strNode)
+inline int rapidjson::scan(const std::string& strFile)
 {
-    std::string strNodePath;
-    std::string strChildren;
-    uint64_t ulArrayElemnt = 0;
-    split(strNode, strNodePath, strChildren, ulArrayElemnt);
-    std::vector<std::string> vecElements;
+    int         iRet = -1;
+    struct stat stFile;
+    int         iFd  = open(strFile.c_str(), O_RDONLY | O_CLOEXEC);
 
-    // Get the elemnts of the node if it is object and not empty
-    if(strChildren.empty())
+    if((iFd >= 0) && 
+       (fstat(iFd, &stFile) == 0) && 
+       (stFile.st_size != 0))
     {
-        if (ulArrayElemnt == IS_OBJECT)
+        void* pvMapping = mmap(nullptr, static_cast<size_t>(stFile.st_size), PROT_READ, MAP_PRIVATE, iFd, 0);
+        if(pvMapping != MAP_FAILED)
         {
-            for (auto itr = jsonObject[strNodePath.c_str()].MemberBegin(); itr != jsonObject[strNodePath.c_str()].MemberEnd(); itr++)
-            {
-                if (itr->name.IsString())
-                {  
-                    vecElements.push_back(itr->name.GetString());
-                }
-            } 
+            madvise(pvMapping, static_cast<size_t>(stFile.st_size), MADV_SEQUENTIAL);
+            iRet = scan(static_cast<const char*>(pvMapping), static_cast<size_t>(stFile.st_size));
+            munmap(pvMapping, static_cast<size_t>(stFile.st_size));
         }
-        else
-        {
-            if (jsonObject[strNodePath.c_str()][ulArrayElemnt].IsObject())
-            {
-                for (auto itr = jsonObject[strNodePath.c_str()][ulArrayElemnt].MemberBegin(); itr != jsonObject[strNodePath.c_str()][ulArrayElemnt].MemberEnd(); itr++)
-                {
-                    if (itr->name.IsString())
-                    {  
-                        vecElements.push_back(itr->name.GetString());
-                    }
-                } 
-            }
-        }    
     }
-    else
+    if(iFd >= 0)
     {
-        if (ulArrayElemnt == IS_OBJECT)
-        {   // Process if is object      
-            vecElements = processList(jsonObject[strNodePath.c_str()], strChildren);
-        }
-        else
-        {   // Process if is array 
-            vecElements = processList(jsonObject[strNodePath.c_str()][ulArrayElemnt], strChildren);
-        }
+        close(iFd);
     }
-    // Return processing result (list of the elments in this node)
-    return vecElements;
-}
 
+    // Return processing result
+    return iRet;
+}
 
 /**
- * @brief set / add object with datatype
+ * @brief Map the json file and index its brackets (lazy load)
  * 
- * @tparam T_TYPEA 
- * @param memberName Json object member value
- * @param tType data type
- * @param jsonObject json array 
- * @param eType typr of process
+ * The brackets are indexed by the SIMD scanner, which also checks the UTF-8
+ * encoding and the strings; texts of 4 GB and more are indexed by a scalar
+ * pass. The values are not validated here: each node read validates the
+ * value it parses, and parsing the whole document validates the text (a
+ * malformed text then fails the reads and writes of the whole document).
+ * 
+ * @param strFile JSON file path
  * @return int processing result
  */
-template<typename T_TYPEA>
-int rapidjson::castData(::rapidjson::Value& memberName, const T_TYPEA& tType, ::rapidjson::Value& jsonObject, const stProcess::TYPE& eType)
+inline int rapidjson::lazy(const std::string& strFile)
 {
-    int iRet = 0;
+    int                     iRet  = 0;
+    struct stat             stFile;
+    std::unique_ptr<stLazy> pLazy(new stLazy());
+    int                     iFd   = open(strFile.c_str(), O_RDONLY | O_CLOEXEC);
 
-    if(std::is_same<T_TYPEA, std::string>::value)
-    {   //set string
-        const std::string& strValue = reinterpret_cast<const std::string&>(tType);
-        ::rapidjson::Value memberValue(::rapidjson::kStringType);
-        switch (eType)
+    if((iFd < 0) || 
+       (fstat(iFd, &stFile) != 0) || 
+       (stFile.st_size == 0))
+    {
+        iRet = -1;
+    }
+    if(!iRet)
+    {
+        void* pvMapping = mmap(nullptr, static_cast<size_t>(stFile.st_size), PROT_READ, MAP_PRIVATE, iFd, 0);
+        if(pvMapping == MAP_FAILED)
         {
-            case stProcess::TYPE::SET:
-                jsonObject.SetString(strValue.c_str(),m_allocator);
-                break;
-            case stProcess::TYPE::PUSHBACK:
-                memberValue.SetString(strValue.c_str(), m_allocator);
-                jsonObject.PushBack(memberValue, m_childDocJsonFile.GetAllocator());
-                break;
-            case stProcess::TYPE::ADD:
-                memberValue.SetString(strValue.c_str(), m_allocator);
-                jsonObject.AddMember(memberName, memberValue, m_allocator);
-                break;
-
-            default:
-                iRet = -1;
-                break;
+            iRet = -1;
         }
-    }
-    else if(std::is_same<T_TYPEA, bool>::value)
-    {   // set bool
-        const bool& bValue = reinterpret_cast<const bool&>(tType);
-        switch (eType)
+        else
         {
-            case stProcess::TYPE::SET:
-                jsonObject.SetBool(bValue);
-                break;
-            case stProcess::TYPE::PUSHBACK:
-                jsonObject.PushBack(bValue, m_allocator);
-                break;
-            case stProcess::TYPE::ADD:
-                jsonObject.AddMember(memberName, bValue, m_allocator);
-                break;
-
-            default:
-                iRet = -1;
-                break;
+            pLazy->pcText = static_cast<const char*>(pvMapping);
+            pLazy->ulSize = static_cast<size_t>(stFile.st_size);
         }
     }
-    else if(std::is_integral<T_TYPEA>::value)
-    {// set int
-        if(sizeof(T_TYPEA) <= 4)
-        {// Up to 4 bytes
-            if (std::is_same<T_TYPEA, int>::value)
-            {
-                const int& iValue = reinterpret_cast<const int&>(tType);
-                iRet = setElement(memberName, iValue, jsonObject, eType, stProcess::TYPE::SETINT);
-            }
-            else if (std::is_same<T_TYPEA, int16_t>::value)
-            {
-                const int16_t& sValue = reinterpret_cast<const int16_t&>(tType);
-                iRet = setElement(memberName, sValue, jsonObject, eType, stProcess::TYPE::SETINT);
-            }
-            else if (std::is_same<T_TYPEA, int8_t>::value)
-            {
-                const int8_t& cValue = reinterpret_cast<const int8_t&>(tType);
-                iRet = setElement(memberName, cValue, jsonObject, eType, stProcess::TYPE::SETINT);
-            }
-            else if(std::is_same<T_TYPEA, uint32_t>::value)
-            {// Unsigned
-                const uint32_t& uiValue = reinterpret_cast<const uint32_t&>(tType);
-                iRet = setElement(memberName, uiValue, jsonObject, eType, stProcess::TYPE::SETUINT);
-            }
-            else if(std::is_same<T_TYPEA, uint16_t>::value)
-            {// Unsigned
-                const uint16_t& usValue = reinterpret_cast<const uint16_t&>(tType);
-                iRet = setElement(memberName, usValue, jsonObject, eType, stProcess::TYPE::SETUINT);
-            }
-            else if(std::is_same<T_TYPEA, uint8_t>::value)
-            {// Unsigned
-                const uint8_t& ucValue = reinterpret_cast<const uint8_t&>(tType);
-                iRet = setElement(memberName, ucValue, jsonObject, eType, stProcess::TYPE::SETUINT);
-            }
-            else
+    if(iFd >= 0)
+    {   // The mapping stays valid once the file is closed
+        close(iFd);
+    }
+    // Index the brackets, then check the single root value
+    if(!iRet)
+    {
+        madvise(const_cast<char*>(pLazy->pcText), pLazy->ulSize, MADV_SEQUENTIAL);
+        if(pLazy->ulSize < UINT32_MAX)
+        {
+            if(!m_pScanner)
             {
-                iRet = -2;
+                m_pScanner.reset(new scanner());
             }
+            iRet = m_pScanner->brackets(pLazy->pcText, pLazy->ulSize, pLazy->vecOpen, pLazy->vecClose);
         }
         else
-        {// Up to 8 bytes
-            if(std::is_same<T_TYPEA, int64_t>::value)
-            {// Signed
-                const int64_t& lValue = reinterpret_cast<const int64_t&>(tType);
-                iRet = setElement(memberName, lValue, jsonObject, eType, stProcess::TYPE::SETINT64);
-            }
-            else if (std::is_same<T_TYPEA, uint64_t>::value)
-            {
-                const uint64_t& ulValue = reinterpret_cast<const uint64_t&>(tType);
-                iRet = setElement(memberName, ulValue, jsonObject, eType, stProcess::TYPE::SETUINT64);
-            }
-            else
-            {
-                iRet = -2;
-            }
-        }
-    }
-    else if(std::is_same<T_TYPEA, float>::value)
-    {   // set float
-        const float& fValue = reinterpret_cast<const float&>(tType);
-        switch (eType)
         {
-            case stProcess::TYPE::SET:
-                jsonObject.SetFloat(fValue);
-                break;
-            case stProcess::TYPE::PUSHBACK:
-                jsonObject.PushBack(fValue, m_allocator);
-                break;
-            case stProcess::TYPE::ADD:
-                jsonObject.AddMember(memberName, fValue, m_allocator);
-                break;
-
-            default:
-                iRet = -1;
-                break;
+            iRet = pLazy->index();
         }
-    }
-    else if(std::is_same<T_TYPEA, double>::value)
-    {   // set float
-        const double& dValue = reinterpret_cast<const double&>(tType);
-        switch (eType)
+        if(!iRet)
         {
-            case stProcess::TYPE::SET:
-                jsonObject.SetDouble(dValue);
-                break;
-            case stProcess::TYPE::PUSHBACK:
-                jsonObject.PushBack(dValue, m_allocator);
-                break;
-            case stProcess::TYPE::ADD:
-                jsonObject.AddMember(memberName, dValue, m_allocator);
-                break;
-
-            default:
-                iRet = -1;
-                break;
+            iRet = pLazy->root();
         }
+        madvise(const_cast<char*>(pLazy->pcText), pLazy->ulSize, MADV_NORMAL);
     }
-    else
-    {   
-        iRet = -1;
+    if(!iRet)
+    {   // Replace the document by the lazy one
+        m_docJsonFile.SetObject();
+        indexBuild();
+        release();
+        m_pLazy = std::move(pLazy);
+        m_bLazy = true;
     }
 
     // Return processing result
@@ -1675,468 +4985,141 @@ int rapidjson::castData(::rapidjson::Value& memberName, const T_TYPEA& tType, ::
 }
 
 /**
- * @brief Get the Element object
+ * @brief Get the document, parsed first if it is lazy loaded
  * 
- * @tparam T_VALUE 
- * @param tValue data value
- * @param jsonObject json array 
- * @param ulArrayElemnt the number of the array element
- * @return int processing result
+ * @return ::rapidjson::Document& Processing result
  */
-template<typename T_VALUE>
-int rapidjson::getElement(T_VALUE& tValue, ::rapidjson::Value& jsonObject, const uint64_t& ulArrayElemnt)
+inline ::rapidjson::Document& rapidjson::document()
 {
-    int iRet = 0;
-
-    if (jsonObject.IsArray() && jsonObject.Size() > ulArrayElemnt)
-    {   // Get elemnts if it is an array 
-        iRet = element(jsonObject[ulArrayElemnt], tValue);
-    }
-    else if(jsonObject.IsObject())
-    {
-        iRet = -1;
-    }
-    else
-    {
-        // Get elemnts if it is a datatypa
-        iRet = element(jsonObject, tValue);
-    }
-    // Return processing result
-    return iRet;
+    materialize();
+    return m_docJsonFile;
 }
 
 /**
- * @brief Get the type of a specific node
+ * @brief Get the document, parsed first if it is lazy loaded
  * 
- * @param jsonObject object of the json file
- * @return JSON_TYPE type of node
+ * @return const ::rapidjson::Document& Processing result
  */
-rapidjson::TYPE rapidjson::type(::rapidjson::Value& jsonObject)
+inline const ::rapidjson::Document& rapidjson::document() const
 {
-    rapidjson::TYPE eType = rapidjson::TYPE::UKNOWN;
-
-    // Get the type of the node 
-    switch (jsonObject.GetType())
-    {
-        case ::rapidjson::kArrayType:
-            eType = rapidjson::TYPE::ARRAY;
-            break;
-        case ::rapidjson::kObjectType:
-            eType = rapidjson::TYPE::OBJECT;
-            break;
-        case ::rapidjson::kTrueType:
-        case ::rapidjson::kFalseType:
-            eType = rapidjson::TYPE::BOOL;
-            break;
-        case ::rapidjson::kStringType:
-            eType = rapidjson::TYPE::STRING;
-            break;
-        case ::rapidjson::kNumberType:
-            if(jsonObject.IsInt())
-            {
-                eType = rapidjson::TYPE::SINT32;
-            }
-            else if (jsonObject.IsUint())
-            {
-                eType = rapidjson::TYPE::UINT32;
-            }
-            else if (jsonObject.IsInt64())
-            {
-                eType = rapidjson::TYPE::SINT64;
-            }
-            else if (jsonObject.IsUint64())
-            {
-                eType = rapidjson::TYPE::UINT64;
-            }
-            else if (jsonObject.IsFloat())
-            {
-                eType = rapidjson::TYPE::FLOAT;
-            }
-            else if (jsonObject.IsDouble())
-            {
-                eType = rapidjson::TYPE::DOUBLE;
-            }
-            
-            break;
-        
-        default:
-            break;
-    }
-
-    // Return processing result (node type)
-    return eType;
-
+    materialize();
+    return m_docJsonFile;
 }
 
 /**
- * @brief Get the elemnt of a specific type
- * @tparam T_VALUE 
- * @param jsonObject object of the json file
- * @param tValue Value to retrieve
- * @return  int processing result
+ * @brief Parse the whole lazy loaded document
+ * 
+ * The document is the parsed form of the raw text, parsing it does not change
+ * the value of this object. A malformed text stays lazy loaded: its nodes
+ * are still read, the reads and writes of the whole document fail.
+ * 
+ * @return int Processing result
  */
-template<typename T_VALUE>
-int rapidjson::element(::rapidjson::Value& jsonObject, T_VALUE& tValue)
+inline int rapidjson::materialize() const
 {
     int iRet = 0;
-    // Get the type of the node in the json file
-    TYPE eType = type(jsonObject);
-    // Get elemnt depends on its data type
-    switch (eType)
-    {
-        case rapidjson::TYPE::STRING:
-          {
-            if(std::is_same<T_VALUE, std::string>::value)
-            {   // Get string element
-                std::string& strValue = reinterpret_cast<std::string&>(tValue);   
-                strValue = jsonObject.GetString();
-            }
-            else
-            {
-                iRet = -2;
-            }
-            break;
-          }
-        case rapidjson::TYPE::BOOL:
-            if(std::is_same<T_VALUE, bool>::value)
-            {   // Get bool element
-                tValue = jsonObject.GetBool();
-            }
-            else
-            {
-                iRet = -2;
-            }
-            break;
-        case rapidjson::TYPE::FLOAT:
-            if (jsonObject.IsFloat() && std::is_same<T_VALUE, float>::value)
-            {   // Get float element
-                tValue = jsonObject.GetFloat();
-            }
-            else if (jsonObject.IsDouble() && std::is_same<T_VALUE, double>::value)
-            {   // Get double element
-                tValue = jsonObject.GetDouble();
-            }
-            else
-            {
-                iRet = -2;
-            }
-            break;
-        case rapidjson::TYPE::SINT32:
-            {
-                int32_t  iValue = jsonObject.GetInt();
-                uint32_t uiValue = 0;
-                if(jsonObject.GetInt() >= 0)
-                {
-                    uiValue = jsonObject.GetUint();
-                }
-                if(std::is_same<T_VALUE, uint32_t>::value)
-                {  
-                    if((iValue >= 0) && (uiValue <= UINT32_MAX))
-                    {   // Get uint23_t element
-                        tValue = static_cast<uint32_t>(uiValue);
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }   
-                }
-                else if (std::is_same<T_VALUE, uint16_t>::value)
-                {   
-                    if((iValue >= 0) && (uiValue <= UINT16_MAX))
-                    {
-                        // Get uint16 element
-                        tValue = static_cast<uint16_t>(uiValue);
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }   
-                }
-                else if (std::is_same<T_VALUE, uint8_t>::value)
-                {   
-                    if((iValue >= 0) && (uiValue <= UINT8_MAX))
-                    {
-                        // Get uint16 element
-                        tValue = static_cast<uint8_t>(uiValue);
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }   
-                }
-                else if(std::is_same<T_VALUE, int>::value)
-                {  
-                    if(iValue <= INT_MAX && iValue >= INT_MIN)
-                    {
-                        // Get int element
-                        tValue = static_cast<int>(iValue);
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }   
-                }
-                else if (std::is_same<T_VALUE, int8_t>::value)
-                {   
-                    if (iValue <= INT8_MAX && iValue >= INT8_MIN)
-                    {
-                        // Get int16_t element
-                        tValue = static_cast<int8_t>(iValue);
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }   
-                }
-                else if (std::is_same<T_VALUE, int16_t>::value)
-                {   
-                    if (iValue <= INT16_MAX && iValue >= INT16_MIN)
-                    {
-                        // Get int16_t element
-                        tValue = static_cast<int16_t>(iValue);
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }   
-                }
-                else if (std::is_same<T_VALUE, int32_t>::value)
-                {  
-                    if (iValue <= INT32_MAX && iValue >= INT32_MIN)
-                    {
-                        // Get int32_t element
-                        tValue = static_cast<int32_t>(iValue);
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }  
-                }
-                else if (std::is_same<T_VALUE, int64_t>::value)
-                {   // Get int64 element
-                    tValue = jsonObject.GetInt64();
-                }
-                else if (std::is_same<T_VALUE, uint64_t>::value)
-                {   
-                    if (jsonObject.GetInt64() >= 0)
-                    {
-                        // Get uint16 element
-                        tValue = jsonObject.GetUint64();
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }
-                }
-                else if (std::is_same<T_VALUE, float>::value)
-                {   // Get float element
-                    tValue = jsonObject.GetFloat();
-                }
-                else if (std::is_same<T_VALUE, double>::value)
-                {   // Get double element
-                    tValue = jsonObject.GetDouble();
-                }
-                else
-                {
-                    iRet = -2;
-                }
-                break;
-            }
-        case rapidjson::TYPE::SINT64:
-            if (std::is_same<T_VALUE, int64_t>::value)
-            {   // Get int64 element
-                tValue = jsonObject.GetInt64();
-            }
-            else if (std::is_same<T_VALUE, uint64_t>::value)
-            {   
-                if (jsonObject.GetInt64() >= 0)
-                {
-                    // Get uint16 element
-                    tValue = jsonObject.GetUint64();
-                }
-                else
-                {
-                    iRet = -2;
-                }
+
+    if(m_bLazy.load(std::memory_order_acquire))
+    {
+        std::unique_lock<std::shared_mutex> lockLazy(m_mutexLazy);
+        if(!m_bLazy.load(std::memory_order_relaxed))
+        {
+            // Parsed meanwhile
+        }
+        else if(m_pLazy->bInvalid)
+        {
+            iRet = -1;
+        }
+        else
+        {
+            ::rapidjson::Document& docJsonFile = const_cast<::rapidjson::Document&>(m_docJsonFile);
+            if(dispatch([&](auto flags) { return !docJsonFile.Parse<decltype(flags)::value>(m_pLazy->pcText, m_pLazy->ulSize).HasParseError(); }))
+            {   // Indexed before it is published, the parsed lazy nodes are kept for their readers
+                indexBuild();
+                m_bLazy.store(false, std::memory_order_release);
             }
             else
-            {
-                iRet = -2;
+            {   // The document keeps its value on a parse error
+                m_pLazy->bInvalid = true;
+                iRet = -1;
             }
-            break;
-        case rapidjson::TYPE::UINT32:
-           {
-                uint32_t uiValue  = jsonObject.GetUint();
-                if(std::is_same<T_VALUE, uint32_t>::value)
-                {  
-                    if(uiValue <= UINT32_MAX)
-                    {   // Get uint23_t element
-                        tValue = static_cast<uint32_t>(uiValue);
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }   
-                }
-                else if (std::is_same<T_VALUE, uint16_t>::value)
-                {   
-                    if(uiValue <= UINT16_MAX)
-                    {
-                        // Get uint16 element
-                        tValue = static_cast<uint16_t>(uiValue);
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }   
-                }
-                else if (std::is_same<T_VALUE, uint8_t>::value)
-                {   
-                    if(uiValue <= UINT8_MAX)
-                    {
-                        // Get uint16 element
-                        tValue = static_cast<uint8_t>(uiValue);
-                    }
-                    else
-                    {
-                        iRet = -2;
-                    }   
-                }
-                break;
-           }
-        case rapidjson::TYPE::UINT64:
-            tValue = jsonObject.GetUint64();
-            break;
-        case rapidjson::TYPE::DOUBLE:
-            tValue = jsonObject.GetDouble();
-            break;
-        default:
-            iRet = -1;
-            break;
+        }
     }
+
     // Return processing result
     return iRet;
 }
 
 /**
- * @brief Set the Element object
+ * @brief Get the number of bytes allocated for the lazy nodes
  * 
- * @tparam T_VALUE 
- * @param tValue data value
- * @param jsonObject json array 
- * @param ulArrayElemnt the number of the array element
- * @param eType type of process
- * @return int processing result
+ * The lazy state is kept once the document is parsed, for the readers of its
+ * nodes.
+ * 
+ * @return size_t Processing result
  */
-template<typename T_VALUE>
-int rapidjson::setElement(::rapidjson::Value& memberName , const T_VALUE& tValue, ::rapidjson::Value& jsonObject, const rapidjson::stProcess::TYPE& eType, const stProcess::TYPE& eDataType)
+inline size_t rapidjson::lazyAllocated() const
 {
+    size_t ulSize = 0;
 
-    int iRet = 0;
-    switch (eType)
-    {
-        case stProcess::TYPE::SET:
-            if (eDataType == rapidjson::stProcess::TYPE::SETINT)
-            {
-                jsonObject.SetInt(tValue);
-            }
-            else if (eDataType == rapidjson::stProcess::TYPE::SETUINT)
-            {
-                jsonObject.SetUint(tValue);
-            }
-            else if (eDataType == rapidjson::stProcess::TYPE::SETINT64)
-            {
-                jsonObject.SetInt64(tValue);
-            }
-            else if (eDataType == rapidjson::stProcess::TYPE::SETUINT64)
-            {
-                jsonObject.SetUint64(tValue);
-            }
-            else
-            {
-                iRet = -2;
-            }
-            break;
-        case stProcess::TYPE::PUSHBACK:
-            jsonObject.PushBack(tValue, m_allocator);
-            break;
-        case stProcess::TYPE::ADD:
-            jsonObject.AddMember(memberName, tValue, m_allocator);
-            break;
-
-        default:
-            iRet = -1;
-            break;
+    if(m_pLazy)
+    {   // Nodes are parsed under the exclusive lock
+        std::shared_lock<std::shared_mutex> lockLazy(m_mutexLazy);
+        ulSize = m_pLazy->allocator.Size();
     }
-    // Return processing result (node type)
-    return iRet;  
+
+    // Return processing result
+    return ulSize;
 }
 
 /**
- * @brief Get the vector of elements 
+ * @brief Find a node to read based its compiled path
  * 
- * @tparam T_VALUE 
- * @param vecValue data value
- * @param jsonObject json array 
- * @param ulArrayElemnt the number of the array element
- * @return int processing result
+ * A lazy node is located and looked up in the cache under the shared lock,
+ * the exclusive lock is only taken to parse a node read for the first time.
+ * The parsed nodes are never moved, so their readers keep them unlocked.
+ * 
+ * @param path Compiled JSON node path
+ * @return const ::rapidjson::Value* Node (nullptr if not found)
  */
-template<typename T_VALUE>
-int rapidjson::getVector(std::vector<T_VALUE>& vecValue, const std::string& strNodeFirst)
+inline const ::rapidjson::Value* rapidjson::node(const stPath& path) const
 {
-    int         iRet    = 0;
-    uint32_t    uiSize  = size(strNodeFirst);
-    std::string strPath = strNodeFirst;
-    T_VALUE     tValue;
+    const ::rapidjson::Value* pNode   = nullptr;
+    bool                      bLazy   = m_bLazy.load(std::memory_order_acquire);
+    bool                      bCached = true;
+    uint64_t                  ulPos   = stLazy::NOT_FOUND;
 
-    // Loop over all items
-    for(uint32_t uiCnt = 0; uiCnt < uiSize; ++uiCnt)
+    if(bLazy)
     {
-        // Get item
-        strPath = strNodeFirst + "[" + std::to_string(uiCnt) + "]";
-        iRet = get(tValue, strPath);
-        if(iRet)
+        std::shared_lock<std::shared_mutex> lockLazy(m_mutexLazy);
+        bLazy = m_bLazy.load(std::memory_order_relaxed);
+        if(bLazy)
         {
-            break;
+            ulPos   = m_pLazy->find(path);
+            bCached = (ulPos == stLazy::NOT_FOUND) || m_pLazy->cached(ulPos, pNode);
         }
-        // Add item to the list
-        vecValue.push_back(tValue);
     }
-
-    // Return process
-    return iRet;
-
-}
-
-/**
- * @brief Set the vector of elements 
- * 
- * @tparam T_VALUE 
- * @param vecValue data value
- * @param strNode path of the node
- * @return int processing result
- */
-template<typename T_VALUE>
-int rapidjson::setVector(const std::vector<T_VALUE>& vecValue, const std::string& strNode)
-{
-    int         iRet    = 0;
-    uint32_t    uiSize  = vecValue.size();
-    std::string strPath = strNode;
-
-    // Loop over all items
-    for(uint32_t uiCnt = 0; uiCnt < uiSize; ++uiCnt)
+    if((bLazy) && 
+       (!bCached))
     {
-        // Get item
-        strPath = strNode + "[" + std::to_string(uiCnt) + "]";
-        iRet = set(vecValue[uiCnt], strPath);
-        if(iRet)
+        std::unique_lock<std::shared_mutex> lockLazy(m_mutexLazy);
+        // The document may have been parsed meanwhile
+        bLazy = m_bLazy.load(std::memory_order_relaxed);
+        if(bLazy)
         {
-            break;
+            pNode = m_pLazy->value(ulPos, [this](::rapidjson::Document& docParser, const char* pcText, const size_t& ulLength)
+            {
+                return dispatch([&](auto flags) { return !docParser.Parse<decltype(flags)::value>(pcText, ulLength).HasParseError(); });
+            });
         }
     }
-    
-    // Return process
-    return iRet;
+    if(!bLazy)
+    {
+        pNode = find(m_docJsonFile, path);
+    }
+
+    // Return processing result
+    return pNode;
 }
 
 /**
@@ -2148,7 +5131,7 @@ int rapidjson::setVector(const std::vector<T_VALUE>& vecValue, const std::string
  * @param ulArrayElemnt array number
  * @return int processing result
  */
-int rapidjson::split(const std::string& strPath, std::string& strNode, std::string& strChildren, uint64_t& ulArrayElemnt)
+int rapidjson::split(const std::string& strPath, std::string& strNode, std::string& strChildren, uint64_t& ulArrayElemnt) const
 {
     std::pair<std::string, std::string> pairNode = string::split(strPath, m_cNodePathSeparator);
     const std::string& strName     = pairNode.first;
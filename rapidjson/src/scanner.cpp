@@ -0,0 +1,929 @@
+/**
+ * @file scanner.cpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief SIMD structural scanner parse front-end
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCANNER_X86
+#endif
+#include "scanner.hpp"
+#include "memorystream.h"
+
+
+namespace utilities {
+
+
+#define BLOCK_SIZE 64
+#define EVEN_BITS  0x5555555555555555ULL
+
+
+/**
+ * @brief Character classes of a block, one bit per byte
+ */
+struct stMasks
+{
+    uint64_t ulQuote     {0};
+    uint64_t ulBackslash {0};
+    uint64_t ulSpace     {0};
+    uint64_t ulOperator  {0};
+    uint64_t ulControl   {0};
+};
+
+/**
+ * @brief Classify a block of BLOCK_SIZE bytes
+ */
+typedef void (*tClassify)(const char* pcBlock, stMasks& masks);
+
+/**
+ * @brief Get the length of the ASCII prefix of a text
+ */
+typedef size_t (*tAscii)(const char* pcData, const size_t& ulSize);
+
+/**
+ * @brief Kernels selected for this CPU
+ */
+struct stKernel
+{
+    const char* pcName;
+    tClassify   classify;
+    tAscii      ascii;
+};
+
+/**
+ * @brief Classify a block (scalar)
+ *
+ * @param pcBlock Block of BLOCK_SIZE bytes
+ * @param masks Character classes
+ */
+static void classifyScalar(const char* pcBlock, stMasks& masks)
+{
+    masks = stMasks();
+    for(uint32_t uiCnt = 0; uiCnt < BLOCK_SIZE; ++uiCnt)
+    {
+        uint8_t  ucData = static_cast<uint8_t>(pcBlock[uiCnt]);
+        uint64_t ulBit  = 1ULL << uiCnt;
+        switch(ucData)
+        {
+            case '"':
+                masks.ulQuote |= ulBit;
+                break;
+            case '\\':
+                masks.ulBackslash |= ulBit;
+                break;
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+                masks.ulSpace |= ulBit;
+                break;
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',':
+                masks.ulOperator |= ulBit;
+                break;
+            default:
+                break;
+        }
+        if(ucData < 0x20)
+        {
+            masks.ulControl |= ulBit;
+        }
+    }
+}
+
+/**
+ * @brief Get the length of the ASCII prefix of a text (scalar)
+ *
+ * @param pcData Text
+ * @param ulSize Text length
+ * @return size_t Processing result
+ */
+static size_t asciiScalar(const char* pcData, const size_t& ulSize)
+{
+    size_t ulPos = 0;
+    for(uint64_t ulWord = 0; ulPos + sizeof(ulWord) <= ulSize; ulPos += sizeof(ulWord))
+    {
+        memcpy(&ulWord, pcData + ulPos, sizeof(ulWord));
+        if(ulWord & 0x8080808080808080ULL)
+        {
+            break;
+        }
+    }
+    while((ulPos < ulSize) &&
+          ((static_cast<uint8_t>(pcData[ulPos]) & 0x80) == 0))
+    {
+        ++ulPos;
+    }
+    return ulPos;
+}
+
+#ifdef SCANNER_X86
+/**
+ * @brief Classify a block (SSE4.2)
+ *
+ * @param pcBlock Block of BLOCK_SIZE bytes
+ * @param masks Character classes
+ */
+__attribute__((target("sse4.2")))
+static void classifySse42(const char* pcBlock, stMasks& masks)
+{
+    const __m128i xQuote     = _mm_set1_epi8('"');
+    const __m128i xBackslash = _mm_set1_epi8('\\');
+    const __m128i xSpace     = _mm_set1_epi8(' ');
+    const __m128i xTab       = _mm_set1_epi8('\t');
+    const __m128i xLineFeed  = _mm_set1_epi8('\n');
+    const __m128i xReturn    = _mm_set1_epi8('\r');
+    const __m128i xLower     = _mm_set1_epi8(0x20);
+    const __m128i xOpen      = _mm_set1_epi8('{');
+    const __m128i xClose     = _mm_set1_epi8('}');
+    const __m128i xColon     = _mm_set1_epi8(':');
+    const __m128i xComma     = _mm_set1_epi8(',');
+    const __m128i xControl   = _mm_set1_epi8(0x1F);
+
+    masks = stMasks();
+    for(uint32_t uiCnt = 0; uiCnt < BLOCK_SIZE; uiCnt += sizeof(__m128i))
+    {
+        __m128i xData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pcBlock + uiCnt));
+        // '[' and ']' differ from '{' and '}' by 0x20
+        __m128i xBracket = _mm_or_si128(xData, xLower);
+        __m128i xSpaces  = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(xData, xSpace), _mm_cmpeq_epi8(xData, xTab)),
+                                        _mm_or_si128(_mm_cmpeq_epi8(xData, xLineFeed), _mm_cmpeq_epi8(xData, xReturn)));
+        __m128i xOps     = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(xBracket, xOpen), _mm_cmpeq_epi8(xBracket, xClose)),
+                                        _mm_or_si128(_mm_cmpeq_epi8(xData, xColon), _mm_cmpeq_epi8(xData, xComma)));
+        // Unsigned byte <= 0x1F
+        __m128i xCtrl    = _mm_cmpeq_epi8(_mm_min_epu8(xData, xControl), xData);
+        masks.ulQuote     |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(xData, xQuote)))) << uiCnt;
+        masks.ulBackslash |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(xData, xBackslash)))) << uiCnt;
+        masks.ulSpace     |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(xSpaces))) << uiCnt;
+        masks.ulOperator  |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(xOps))) << uiCnt;
+        masks.ulControl   |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(xCtrl))) << uiCnt;
+    }
+}
+
+/**
+ * @brief Get the length of the ASCII prefix of a text (SSE4.2)
+ *
+ * @param pcData Text
+ * @param ulSize Text length
+ * @return size_t Processing result
+ */
+__attribute__((target("sse4.2")))
+static size_t asciiSse42(const char* pcData, const size_t& ulSize)
+{
+    size_t ulPos = 0;
+    for(; ulPos + sizeof(__m128i) <= ulSize; ulPos += sizeof(__m128i))
+    {
+        if(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pcData + ulPos))) != 0)
+        {
+            break;
+        }
+    }
+    return ulPos + asciiScalar(pcData + ulPos, ulSize - ulPos);
+}
+
+/**
+ * @brief Classify a block (AVX2)
+ *
+ * @param pcBlock Block of BLOCK_SIZE bytes
+ * @param masks Character classes
+ */
+__attribute__((target("avx2")))
+static void classifyAvx2(const char* pcBlock, stMasks& masks)
+{
+    const __m256i yQuote     = _mm256_set1_epi8('"');
+    const __m256i yBackslash = _mm256_set1_epi8('\\');
+    const __m256i ySpace     = _mm256_set1_epi8(' ');
+    const __m256i yTab       = _mm256_set1_epi8('\t');
+    const __m256i yLineFeed  = _mm256_set1_epi8('\n');
+    const __m256i yReturn    = _mm256_set1_epi8('\r');
+    const __m256i yLower     = _mm256_set1_epi8(0x20);
+    const __m256i yOpen      = _mm256_set1_epi8('{');
+    const __m256i yClose     = _mm256_set1_epi8('}');
+    const __m256i yColon     = _mm256_set1_epi8(':');
+    const __m256i yComma     = _mm256_set1_epi8(',');
+    const __m256i yControl   = _mm256_set1_epi8(0x1F);
+
+    masks = stMasks();
+    for(uint32_t uiCnt = 0; uiCnt < BLOCK_SIZE; uiCnt += sizeof(__m256i))
+    {
+        __m256i yData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pcBlock + uiCnt));
+        // '[' and ']' differ from '{' and '}' by 0x20
+        __m256i yBracket = _mm256_or_si256(yData, yLower);
+        __m256i ySpaces  = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(yData, ySpace), _mm256_cmpeq_epi8(yData, yTab)),
+                                           _mm256_or_si256(_mm256_cmpeq_epi8(yData, yLineFeed), _mm256_cmpeq_epi8(yData, yReturn)));
+        __m256i yOps     = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(yBracket, yOpen), _mm256_cmpeq_epi8(yBracket, yClose)),
+                                           _mm256_or_si256(_mm256_cmpeq_epi8(yData, yColon), _mm256_cmpeq_epi8(yData, yComma)));
+        // Unsigned byte <= 0x1F
+        __m256i yCtrl    = _mm256_cmpeq_epi8(_mm256_min_epu8(yData, yControl), yData);
+        masks.ulQuote     |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(yData, yQuote)))) << uiCnt;
+        masks.ulBackslash |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(yData, yBackslash)))) << uiCnt;
+        masks.ulSpace     |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(ySpaces))) << uiCnt;
+        masks.ulOperator  |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(yOps))) << uiCnt;
+        masks.ulControl   |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(yCtrl))) << uiCnt;
+    }
+}
+
+/**
+ * @brief Get the length of the ASCII prefix of a text (AVX2)
+ *
+ * @param pcData Text
+ * @param ulSize Text length
+ * @return size_t Processing result
+ */
+__attribute__((target("avx2")))
+static size_t asciiAvx2(const char* pcData, const size_t& ulSize)
+{
+    size_t ulPos = 0;
+    for(; ulPos + sizeof(__m256i) <= ulSize; ulPos += sizeof(__m256i))
+    {
+        if(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pcData + ulPos))) != 0)
+        {
+            break;
+        }
+    }
+    return ulPos + asciiScalar(pcData + ulPos, ulSize - ulPos);
+}
+#endif
+
+/**
+ * @brief Get the kernels supported by this CPU, best first (once)
+ *
+ * @return const std::vector<stKernel>& Processing result
+ */
+static const std::vector<stKernel>& available()
+{
+    static const std::vector<stKernel> vecKernels = []()
+    {
+        std::vector<stKernel> vecSupported;
+#ifdef SCANNER_X86
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2"))
+        {
+            vecSupported.push_back(stKernel{"avx2", classifyAvx2, asciiAvx2});
+        }
+        if(__builtin_cpu_supports("sse4.2"))
+        {
+            vecSupported.push_back(stKernel{"sse4.2", classifySse42, asciiSse42});
+        }
+#endif
+        vecSupported.push_back(stKernel{"scalar", classifyScalar, asciiScalar});
+        return vecSupported;
+    }();
+    return vecKernels;
+}
+
+/**
+ * @brief Kernels in use, the best one of this CPU unless forced
+ *
+ * @return std::atomic<const stKernel*>& Processing result
+ */
+static std::atomic<const stKernel*>& selected()
+{
+    static std::atomic<const stKernel*> pKernel(&available().front());
+    return pKernel;
+}
+
+/**
+ * @brief Get the kernels in use
+ *
+ * @return const stKernel& Processing result
+ */
+static const stKernel& current()
+{
+    return *selected().load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Parse 4 hexadecimal digits
+ *
+ * @param pcData Digits
+ * @param uiCode Parsed code unit
+ * @return bool Processing result
+ */
+static bool hex4(const char* pcData, uint32_t& uiCode)
+{
+    uiCode = 0;
+    for(uint32_t uiCnt = 0; uiCnt < 4; ++uiCnt)
+    {
+        char cData = pcData[uiCnt];
+        uiCode <<= 4;
+        if((cData >= '0') && (cData <= '9'))
+        {
+            uiCode |= static_cast<uint32_t>(cData - '0');
+        }
+        else if((cData >= 'a') && (cData <= 'f'))
+        {
+            uiCode |= static_cast<uint32_t>(cData - 'a' + 10);
+        }
+        else if((cData >= 'A') && (cData <= 'F'))
+        {
+            uiCode |= static_cast<uint32_t>(cData - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Scalar handler forwarding to the document
+ */
+struct scanner::stScalar : public ::rapidjson::BaseReaderHandler<::rapidjson::UTF8<>, stScalar>
+{
+    ::rapidjson::Document& docHandler;
+
+    explicit stScalar(::rapidjson::Document& docRef):
+        docHandler{docRef}
+    {
+    }
+
+    // Only scalars are expected
+    bool Default() { return false; }
+    bool Null() { return docHandler.Null(); }
+    bool Bool(bool bValue) { return docHandler.Bool(bValue); }
+    bool Int(int iValue) { return docHandler.Int(iValue); }
+    bool Uint(unsigned uiValue) { return docHandler.Uint(uiValue); }
+    bool Int64(int64_t lValue) { return docHandler.Int64(lValue); }
+    bool Uint64(uint64_t ulValue) { return docHandler.Uint64(ulValue); }
+    bool Double(double dValue) { return docHandler.Double(dValue); }
+};
+
+/**
+ * @brief Construct a new scanner object
+ */
+scanner::scanner()
+{
+}
+
+/**
+ * @brief Destroy the scanner object
+ */
+scanner::~scanner()
+{
+}
+
+/**
+ * @brief Get the name of the kernel in use
+ *
+ * @return const char* Processing result ("avx2", "sse4.2" or "scalar")
+ */
+const char* scanner::kernel()
+{
+    return current().pcName;
+}
+
+/**
+ * @brief Force the kernel of every scanner (tests and benchmarks)
+ *
+ * @param strKernel Kernel name ("avx2", "sse4.2" or "scalar")
+ * @return int Processing result (-1 if this CPU does not support it)
+ */
+int scanner::kernel(const std::string& strKernel)
+{
+    int iRet = -1;
+
+    for(const stKernel& kernel : available())
+    {
+        if(strKernel == kernel.pcName)
+        {
+            selected().store(&kernel, std::memory_order_relaxed);
+            iRet = 0;
+        }
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Get the names of the kernels supported by this CPU, best first
+ *
+ * @return std::vector<std::string> Processing result
+ */
+std::vector<std::string> scanner::kernels()
+{
+    std::vector<std::string> vecKernels;
+
+    for(const stKernel& kernel : available())
+    {
+        vecKernels.push_back(kernel.pcName);
+    }
+
+    // Return processing result
+    return vecKernels;
+}
+
+/**
+ * @brief Parse a json text into a document (unchanged on failure)
+ *
+ * @param docJson JSON document
+ * @param pcData JSON text
+ * @param ulSize JSON text length (less than 4 GB)
+ * @return int Processing result
+ */
+int scanner::parse(::rapidjson::Document& docJson, const char* pcData, const size_t& ulSize)
+{
+    int  iRet        = (ulSize < UINT32_MAX)? 0: -1;
+    bool bPopulated  = false;
+
+    m_pcData = pcData;
+    m_ulSize = ulSize;
+    if(!iRet)
+    {
+        iRet = utf8(pcData, ulSize);
+    }
+    if(!iRet)
+    {
+        iRet = index(false);
+    }
+    if(!iRet)
+    {   // The document keeps its value if the generator fails
+        auto generator = [this, &bPopulated](::rapidjson::Document& docHandler)
+        {
+            bPopulated = emit(docHandler);
+            return bPopulated;
+        };
+        docJson.Populate(generator);
+        iRet = bPopulated? 0: -1;
+    }
+    m_pcData = nullptr;
+    m_ulSize = 0;
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Index the matching brackets of a json text, without parsing it
+ *
+ * The brackets are indexed by the SIMD kernel, then paired with a stack.
+ *
+ * @param pcData JSON text
+ * @param ulSize JSON text length (less than 4 GB)
+ * @param vecOpen Offsets of the opening brackets, in text order
+ * @param vecClose Offsets of the matching closing brackets
+ * @return int Processing result
+ */
+int scanner::brackets(const char* pcData, const size_t& ulSize, std::vector<uint64_t>& vecOpen, std::vector<uint64_t>& vecClose)
+{
+    int                 iRet = (ulSize < UINT32_MAX)? 0: -1;
+    std::vector<size_t> vecStack;
+
+    m_pcData = pcData;
+    m_ulSize = ulSize;
+    vecOpen.clear();
+    vecClose.clear();
+    if(!iRet)
+    {
+        iRet = utf8(pcData, ulSize);
+    }
+    if(!iRet)
+    {
+        iRet = index(true);
+    }
+    for(size_t ulCnt = 0; (!iRet) && (ulCnt < m_vecStructurals.size()); ++ulCnt)
+    {
+        uint32_t uiPos = m_vecStructurals[ulCnt];
+        char     cData = pcData[uiPos];
+        if((cData == '{') || 
+           (cData == '['))
+        {
+            vecStack.push_back(vecOpen.size());
+            vecOpen.push_back(uiPos);
+            vecClose.push_back(0);
+        }
+        else if(vecStack.empty() || 
+                (pcData[vecOpen[vecStack.back()]] != ((cData == '}')? '{': '[')))
+        {
+            iRet = -1;
+        }
+        else
+        {
+            vecClose[vecStack.back()] = uiPos;
+            vecStack.pop_back();
+        }
+    }
+    if(!vecStack.empty())
+    {
+        iRet = -1;
+    }
+    m_vecStructurals.clear();
+    m_pcData = nullptr;
+    m_ulSize = 0;
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Check that a text is valid UTF-8
+ *
+ * ASCII runs are skipped by the SIMD kernel, multi-byte sequences are checked
+ * one by one (shortest form, no surrogates, up to U+10FFFF).
+ *
+ * @param pcData Text
+ * @param ulSize Text length
+ * @return int Processing result
+ */
+int scanner::utf8(const char* pcData, const size_t& ulSize)
+{
+    const tAscii ascii = current().ascii;
+    size_t       ulPos = 0;
+
+    for(;;)
+    {
+        ulPos += ascii(pcData + ulPos, ulSize - ulPos);
+        if(ulPos >= ulSize)
+        {
+            break;
+        }
+        const uint8_t* pucData = reinterpret_cast<const uint8_t*>(pcData + ulPos);
+        uint32_t       uiLength = 0;
+        uint8_t        ucMin    = 0x80;
+        uint8_t        ucMax    = 0xBF;
+        if((pucData[0] >= 0xC2) && (pucData[0] <= 0xDF))
+        {
+            uiLength = 2;
+        }
+        else if((pucData[0] >= 0xE0) && (pucData[0] <= 0xEF))
+        {
+            uiLength = 3;
+            ucMin    = (pucData[0] == 0xE0)? 0xA0: ucMin;
+            ucMax    = (pucData[0] == 0xED)? 0x9F: ucMax;
+        }
+        else if((pucData[0] >= 0xF0) && (pucData[0] <= 0xF4))
+        {
+            uiLength = 4;
+            ucMin    = (pucData[0] == 0xF0)? 0x90: ucMin;
+            ucMax    = (pucData[0] == 0xF4)? 0x8F: ucMax;
+        }
+        if((uiLength == 0) ||
+           (ulPos + uiLength > ulSize) ||
+           (pucData[1] < ucMin) ||
+           (pucData[1] > ucMax))
+        {
+            return -1;
+        }
+        for(uint32_t uiCnt = 2; uiCnt < uiLength; ++uiCnt)
+        {
+            if((pucData[uiCnt] & 0xC0) != 0x80)
+            {
+                return -1;
+            }
+        }
+        ulPos += uiLength;
+    }
+
+    // Return processing result
+    return 0;
+}
+
+/**
+ * @brief Index the structural characters of the text
+ *
+ * Per block: the quotes escaped by an odd run of backslashes are dropped, a
+ * prefix xor of the remaining quotes gives the bytes inside the strings, and
+ * the structural characters are the operators outside the strings, the
+ * quotes and the first byte of each scalar. Control characters inside a
+ * string or an unterminated string fail the scan. The bracket index keeps
+ * the brackets outside the strings only.
+ *
+ * @param bBrackets Index the brackets only
+ * @return int Processing result
+ */
+int scanner::index(const bool& bBrackets)
+{
+    const tClassify classify       = current().classify;
+    uint64_t        ulPrevEscaped  = 0;
+    uint64_t        ulPrevInString = 0;
+    uint64_t        ulPrevScalar   = 0;
+    char            acTail[BLOCK_SIZE];
+
+    m_vecStructurals.clear();
+    for(size_t ulBlock = 0; ulBlock < m_ulSize; ulBlock += BLOCK_SIZE)
+    {
+        const char* pcBlock = m_pcData + ulBlock;
+        size_t      ulCount = std::min<size_t>(BLOCK_SIZE, m_ulSize - ulBlock);
+        stMasks     masks;
+        if(ulCount < BLOCK_SIZE)
+        {   // Pad the last block with white spaces
+            memset(acTail, ' ', sizeof(acTail));
+            memcpy(acTail, pcBlock, ulCount);
+            pcBlock = acTail;
+        }
+        classify(pcBlock, masks);
+
+        // Escaped characters: every other character of a backslash run
+        uint64_t ulBackslash     = masks.ulBackslash & ~ulPrevEscaped;
+        uint64_t ulFollowsEscape = (ulBackslash << 1) | ulPrevEscaped;
+        uint64_t ulOddStarts     = ulBackslash & ~EVEN_BITS & ~ulFollowsEscape;
+        uint64_t ulEvenSequences = 0;
+        ulPrevEscaped = __builtin_add_overflow(ulOddStarts, ulBackslash, &ulEvenSequences)? 1: 0;
+        uint64_t ulEscaped       = (EVEN_BITS ^ (ulEvenSequences << 1)) & ulFollowsEscape;
+
+        // Bytes inside the strings, from the opening quote to the closing one
+        uint64_t ulQuote    = masks.ulQuote & ~ulEscaped;
+        uint64_t ulInString = ulQuote;
+        ulInString ^= ulInString << 1;
+        ulInString ^= ulInString << 2;
+        ulInString ^= ulInString << 4;
+        ulInString ^= ulInString << 8;
+        ulInString ^= ulInString << 16;
+        ulInString ^= ulInString << 32;
+        ulInString ^= ulPrevInString;
+        ulPrevInString = 0ULL - (ulInString >> 63);
+        if(masks.ulControl & ulInString)
+        {
+            return -1;
+        }
+
+        // Operators outside the strings, quotes and scalar starts
+        uint64_t ulScalar      = ~(masks.ulSpace | masks.ulOperator | ulQuote | ulInString);
+        uint64_t ulScalarStart = ulScalar & ~((ulScalar << 1) | ulPrevScalar);
+        ulPrevScalar = ulScalar >> 63;
+        uint64_t ulStructural  = (masks.ulOperator & ~ulInString) | (bBrackets? 0: (ulQuote | ulScalarStart));
+        if(ulCount < BLOCK_SIZE)
+        {
+            ulStructural &= (1ULL << ulCount) - 1;
+        }
+        while(ulStructural != 0)
+        {
+            uint32_t uiPos = static_cast<uint32_t>(ulBlock + __builtin_ctzll(ulStructural));
+            if((!bBrackets) || 
+               ((m_pcData[uiPos] != ':') && (m_pcData[uiPos] != ',')))
+            {
+                m_vecStructurals.push_back(uiPos);
+            }
+            ulStructural &= ulStructural - 1;
+        }
+    }
+
+    // Return processing result (a scalar root has no brackets)
+    return ((ulPrevInString == 0) && (bBrackets || !m_vecStructurals.empty()))? 0: -1;
+}
+
+/**
+ * @brief Emit the values of the scanned text (generator of Document::Populate)
+ *
+ * Each string is a pair of quotes in the structural characters, nothing is
+ * indexed inside it.
+ *
+ * @param docHandler Document handler
+ * @return bool Processing result
+ */
+bool scanner::emit(::rapidjson::Document& docHandler)
+{
+    enum class STATE: uint8_t
+    {
+        VALUE = 0,
+        KEY   = 1,
+        NEXT  = 2
+    };
+    const uint32_t* puiStructurals = m_vecStructurals.data();
+    size_t          ulCount        = m_vecStructurals.size();
+    size_t          ulIndex        = 0;
+    STATE           eState         = STATE::VALUE;
+
+    m_vecFrames.clear();
+    for(;;)
+    {
+        if(eState == STATE::VALUE)
+        {
+            if(ulIndex >= ulCount)
+            {
+                return false;
+            }
+            uint64_t ulPos = puiStructurals[ulIndex++];
+            char     cData = m_pcData[ulPos];
+            if((cData == '{') ||
+               (cData == '['))
+            {
+                bool bObject = (cData == '{');
+                if(!(bObject? docHandler.StartObject(): docHandler.StartArray()))
+                {
+                    return false;
+                }
+                if((ulIndex < ulCount) &&
+                   (m_pcData[puiStructurals[ulIndex]] == (bObject? '}': ']')))
+                {   // Empty container
+                    ++ulIndex;
+                    if(!(bObject? docHandler.EndObject(0): docHandler.EndArray(0)))
+                    {
+                        return false;
+                    }
+                    eState = STATE::NEXT;
+                }
+                else
+                {
+                    stFrame frame;
+                    frame.bObject = bObject;
+                    m_vecFrames.push_back(frame);
+                    eState = bObject? STATE::KEY: STATE::VALUE;
+                }
+            }
+            else if(cData == '"')
+            {
+                if((ulIndex >= ulCount) ||
+                   (!string(docHandler, ulPos, puiStructurals[ulIndex++], false)))
+                {
+                    return false;
+                }
+                eState = STATE::NEXT;
+            }
+            else
+            {
+                if(!scalar(docHandler, ulPos))
+                {
+                    return false;
+                }
+                eState = STATE::NEXT;
+            }
+        }
+        else if(eState == STATE::KEY)
+        {   // Name quotes and colon
+            if((ulIndex + 3 > ulCount) ||
+               (m_pcData[puiStructurals[ulIndex]] != '"') ||
+               (!string(docHandler, puiStructurals[ulIndex], puiStructurals[ulIndex + 1], true)) ||
+               (m_pcData[puiStructurals[ulIndex + 2]] != ':'))
+            {
+                return false;
+            }
+            ulIndex += 3;
+            eState   = STATE::VALUE;
+        }
+        else
+        {   // Root value done
+            if(m_vecFrames.empty())
+            {
+                return (ulIndex == ulCount);
+            }
+            if(ulIndex >= ulCount)
+            {
+                return false;
+            }
+            stFrame& frame = m_vecFrames.back();
+            char     cData = m_pcData[puiStructurals[ulIndex++]];
+            ++frame.uiCount;
+            if(cData == ',')
+            {
+                eState = frame.bObject? STATE::KEY: STATE::VALUE;
+            }
+            else if(cData == (frame.bObject? '}': ']'))
+            {
+                bool bEnd = frame.bObject? docHandler.EndObject(frame.uiCount): docHandler.EndArray(frame.uiCount);
+                m_vecFrames.pop_back();
+                if(!bEnd)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                return false;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Emit a string
+ *
+ * @param docHandler Document handler
+ * @param ulBegin Offset of the opening quote
+ * @param ulEnd Offset of the closing quote
+ * @param bKey The string is a member name
+ * @return bool Processing result
+ */
+bool scanner::string(::rapidjson::Document& docHandler, const uint64_t& ulBegin, const uint64_t& ulEnd, const bool& bKey)
+{
+    const char* pcData   = m_pcData + ulBegin + 1;
+    size_t      ulLength = ulEnd - ulBegin - 1;
+
+    if(m_pcData[ulEnd] != '"')
+    {
+        return false;
+    }
+    if(memchr(pcData, '\\', ulLength) != nullptr)
+    {   // Unescape into the string buffer
+        m_strBuffer.clear();
+        for(size_t ulPos = 0; ulPos < ulLength; ++ulPos)
+        {
+            if(pcData[ulPos] != '\\')
+            {
+                m_strBuffer.push_back(pcData[ulPos]);
+                continue;
+            }
+            if(++ulPos >= ulLength)
+            {
+                return false;
+            }
+            uint32_t uiCode = 0;
+            switch(pcData[ulPos])
+            {
+                case '"':  m_strBuffer.push_back('"');  continue;
+                case '\\': m_strBuffer.push_back('\\'); continue;
+                case '/':  m_strBuffer.push_back('/');  continue;
+                case 'b':  m_strBuffer.push_back('\b'); continue;
+                case 'f':  m_strBuffer.push_back('\f'); continue;
+                case 'n':  m_strBuffer.push_back('\n'); continue;
+                case 'r':  m_strBuffer.push_back('\r'); continue;
+                case 't':  m_strBuffer.push_back('\t'); continue;
+                case 'u':  break;
+                default:   return false;
+            }
+            if((ulPos + 4 >= ulLength) ||
+               (!hex4(pcData + ulPos + 1, uiCode)))
+            {
+                return false;
+            }
+            ulPos += 4;
+            if((uiCode >= 0xD800) && (uiCode <= 0xDBFF))
+            {   // Surrogate pair, as the rapidjson reader
+                uint32_t uiLow = 0;
+                if((ulPos + 6 >= ulLength) ||
+                   (pcData[ulPos + 1] != '\\') ||
+                   (pcData[ulPos + 2] != 'u') ||
+                   (!hex4(pcData + ulPos + 3, uiLow)) ||
+                   (uiLow < 0xDC00) ||
+                   (uiLow > 0xDFFF))
+                {
+                    return false;
+                }
+                ulPos += 6;
+                uiCode = (((uiCode - 0xD800) << 10) | (uiLow - 0xDC00)) + 0x10000;
+            }
+            // Encode UTF-8
+            if(uiCode < 0x80)
+            {
+                m_strBuffer.push_back(static_cast<char>(uiCode));
+            }
+            else if(uiCode < 0x800)
+            {
+                m_strBuffer.push_back(static_cast<char>(0xC0 | (uiCode >> 6)));
+                m_strBuffer.push_back(static_cast<char>(0x80 | (uiCode & 0x3F)));
+            }
+            else if(uiCode < 0x10000)
+            {
+                m_strBuffer.push_back(static_cast<char>(0xE0 | (uiCode >> 12)));
+                m_strBuffer.push_back(static_cast<char>(0x80 | ((uiCode >> 6) & 0x3F)));
+                m_strBuffer.push_back(static_cast<char>(0x80 | (uiCode & 0x3F)));
+            }
+            else
+            {
+                m_strBuffer.push_back(static_cast<char>(0xF0 | (uiCode >> 18)));
+                m_strBuffer.push_back(static_cast<char>(0x80 | ((uiCode >> 12) & 0x3F)));
+                m_strBuffer.push_back(static_cast<char>(0x80 | ((uiCode >> 6) & 0x3F)));
+                m_strBuffer.push_back(static_cast<char>(0x80 | (uiCode & 0x3F)));
+            }
+        }
+        pcData   = m_strBuffer.data();
+        ulLength = m_strBuffer.size();
+    }
+
+    // The document copies the string
+    return bKey? docHandler.Key(pcData, static_cast<::rapidjson::SizeType>(ulLength), true):
+                 docHandler.String(pcData, static_cast<::rapidjson::SizeType>(ulLength), true);
+}
+
+/**
+ * @brief Emit a scalar (number, true, false or null)
+ *
+ * @param docHandler Document handler
+ * @param ulBegin Offset of the scalar
+ * @return bool Processing result
+ */
+bool scanner::scalar(::rapidjson::Document& docHandler, const uint64_t& ulBegin)
+{
+    size_t ulEnd = ulBegin;
+    // The scalar ends at a white space, an operator or a quote
+    while((ulEnd < m_ulSize) &&
+          (strchr(" \t\n\r{}[]:,\"", m_pcData[ulEnd]) == nullptr))
+    {
+        ++ulEnd;
+    }
+    if(ulEnd == ulBegin)
+    {
+        return false;
+    }
+    ::rapidjson::MemoryStream memoryStream(m_pcData + ulBegin, ulEnd - ulBegin);
+    stScalar                  scalarHandler(docHandler);
+    return !m_reader.Parse(memoryStream, scalarHandler).IsError();
+}
+
+
+} // namespace utilities
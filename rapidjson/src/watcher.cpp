@@ -0,0 +1,283 @@
+/**
+ * @file watcher.cpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief rapidjson file watcher
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+
+#include <cerrno>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include "watcher.hpp"
+
+
+#define WATCHER_STOP_TIMEOUT 1000
+
+
+namespace utilities {
+
+
+/**
+ * @brief Construct a new watcher object
+ * 
+ * @param holderRef Snapshots holder, its current snapshot path is watched
+ * @param uiDebounce Debounce delay in milliseconds
+ * @param eLoad File load mode
+ * @param callback Reload result callback
+ */
+watcher::watcher(holder& holderRef, const uint32_t& uiDebounce, const rapidjson::LOAD& eLoad, const tCallback& callback):
+    m_holder  {holderRef},
+    m_debounce{uiDebounce},
+    m_eLoad   {eLoad},
+    m_callback{callback}
+{
+}
+
+/**
+ * @brief Destroy the watcher object
+ */
+watcher::~watcher()
+{
+    stop();
+}
+
+/**
+ * @brief Register the schema the reloaded file is checked against
+ * 
+ * @param mapNodes Nodes map 
+ * @return int Processing result
+ */
+int watcher::schema(const std::map<std::string, rapidjson::stNodeConfig>& mapNodes)
+{
+    std::shared_ptr<const rapidjson::stSchema> pSchema = std::make_shared<const rapidjson::stSchema>(m_holder.read()->compile(mapNodes));
+    std::lock_guard<std::mutex>                lockSchema(m_mutexSchema);
+
+    m_pSchema = pSchema;
+
+    // Return processing result
+    return 0;
+}
+
+/**
+ * @brief Start watching
+ * 
+ * The directory is watched rather than the file: a rename-replace swaps the
+ * inode, which would silently end a watch on the file itself.
+ * 
+ * @return int Processing result
+ */
+int watcher::start()
+{
+    int         iRet         = 0;
+    std::string strFilePath  = m_holder.read()->path();
+    std::string strDirectory = ".";
+    size_t      ulSeparator  = strFilePath.rfind('/');
+
+    // Check watcher state and file path
+    if((m_thread.joinable()) || 
+       (strFilePath.empty()))
+    {
+        iRet = -1;
+    }
+    // Watch the directory of the file
+    if(!iRet)
+    {
+        m_strFileName = strFilePath;
+        if(ulSeparator != std::string::npos)
+        {
+            strDirectory  = (ulSeparator == 0)? "/": strFilePath.substr(0, ulSeparator);
+            m_strFileName = strFilePath.substr(ulSeparator + 1);
+        }
+        m_iNotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        m_iStop   = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if((m_iNotify < 0) || 
+           (m_iStop < 0) || 
+           (inotify_add_watch(m_iNotify, strDirectory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0))
+        {
+            release();
+            iRet = -1;
+        }
+    }
+    // Start the watcher thread
+    if(!iRet)
+    {
+        m_thread = std::thread(&watcher::run, this);
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Stop watching
+ * 
+ * The thread is always joined: the stop event only wakes it up early, the
+ * stop flag is also seen at the next bounded poll if the event write fails
+ * (reported as a failure once the thread is joined).
+ * 
+ * @return int Processing result
+ */
+int watcher::stop()
+{
+    int      iRet   = m_thread.joinable()? 0: -1;
+    uint64_t ulStop = 1;
+
+    if(!iRet)
+    {
+        m_bStop = true;
+        // Wake the watcher thread up, a failed write only delays the stop
+        if(write(m_iStop, &ulStop, sizeof(ulStop)) != sizeof(ulStop))
+        {
+            iRet = -1;
+        }
+        m_thread.join();
+        release();
+        m_bStop = false;
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Reload the json file now
+ * 
+ * @return int Processing result
+ */
+int watcher::reload()
+{
+    int                                                          iRet        = 0;
+    std::vector<std::pair<std::string, rapidjson::CHECK_ERROR>>  vecCheckRet;
+    std::string                                                  strFilePath = m_holder.read()->path();
+    std::unique_lock<std::mutex>                                 lockSchema(m_mutexSchema);
+    std::shared_ptr<const rapidjson::stSchema>                   pSchema     = m_pSchema;
+
+    lockSchema.unlock();
+    // Load, check if a schema is registered, and publish
+    if(pSchema)
+    {
+        iRet = m_holder.load(*pSchema, vecCheckRet, strFilePath, m_eLoad);
+    }
+    else
+    {
+        iRet = m_holder.load(strFilePath, m_eLoad);
+    }
+    if(m_callback)
+    {
+        m_callback(iRet, vecCheckRet);
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Watcher thread loop
+ * 
+ * Each event on the watched file pushes the reload deadline, so a burst of
+ * writes ends in a single reload once the file is quiet. The poll is bounded
+ * so the stop flag is seen even without a stop event.
+ */
+void watcher::run()
+{
+    bool                                  bRunning = true;
+    bool                                  bPending = false;
+    std::chrono::steady_clock::time_point deadline;
+    struct pollfd                         aPoll[2] = {{m_iNotify, POLLIN, 0}, {m_iStop, POLLIN, 0}};
+
+    while((bRunning) && 
+          (!m_bStop))
+    {
+        int iTimeout = WATCHER_STOP_TIMEOUT;
+        if(bPending)
+        {
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            iTimeout = std::min<int>(WATCHER_STOP_TIMEOUT, std::max<int>(0, remaining.count()));
+        }
+        int iPoll = poll(aPoll, 2, iTimeout);
+        if(iPoll < 0)
+        {   // An interrupted poll is restarted, any other failure ends the loop
+            bRunning = (errno == EINTR);
+        }
+        else if(aPoll[1].revents != 0)
+        {   // Stop requested
+            bRunning = false;
+        }
+        else if(aPoll[0].revents & POLLIN)
+        {
+            if(events())
+            {
+                bPending = true;
+                deadline = std::chrono::steady_clock::now() + m_debounce;
+            }
+        }
+        else if(aPoll[0].revents != 0)
+        {   // inotify descriptor failure
+            bRunning = false;
+        }
+        // Reload once the file is quiet
+        if((bRunning) && 
+           (bPending) && 
+           (std::chrono::steady_clock::now() >= deadline))
+        {
+            bPending = false;
+            reload();
+        }
+    }
+}
+
+/**
+ * @brief Read the pending inotify events
+ * 
+ * @return bool Processing result (The watched file changed)
+ */
+bool watcher::events()
+{
+    bool    bChanged = false;
+    ssize_t lRead    = 0;
+    alignas(struct inotify_event) char acBuffer[4096];
+
+    // Read until the queue is empty
+    do
+    {
+        lRead = read(m_iNotify, acBuffer, sizeof(acBuffer));
+        for(char* pcEvent = acBuffer; (lRead > 0) && (pcEvent < acBuffer + lRead); )
+        {
+            const struct inotify_event* pEvent = reinterpret_cast<const struct inotify_event*>(pcEvent);
+            if((pEvent->len != 0) && 
+               (m_strFileName == pEvent->name))
+            {
+                bChanged = true;
+            }
+            pcEvent += sizeof(struct inotify_event) + pEvent->len;
+        }
+    } while(lRead > 0);
+
+    // Return processing result
+    return bChanged;
+}
+
+/**
+ * @brief Release the watcher descriptors
+ */
+void watcher::release()
+{
+    if(m_iNotify >= 0)
+    {
+        close(m_iNotify);
+    }
+    if(m_iStop >= 0)
+    {
+        close(m_iStop);
+    }
+    m_iNotify = -1;
+    m_iStop   = -1;
+}
+
+
+} // namespace utilities
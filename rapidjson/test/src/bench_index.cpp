@@ -0,0 +1,139 @@
+/**
+ * @file bench_index.cpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief Member lookup latency in wide objects: rapidjson HasMember and
+ *        FindMember against get() without (index(0)) and with the hashed
+ *        member index (index(BENCH_THRESHOLD))
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "rapidjson.hpp"
+
+
+#define BENCH_LOOKUPS   2000000
+#define BENCH_THRESHOLD 1000
+
+
+/**
+ * @brief Generate a document with one wide object of integer members
+ *
+ * @param uiMembers Member count of the wide object
+ * @param vecKeys Member names, in lookup order (shuffled)
+ * @return std::string JSON document
+ */
+static std::string generate(const uint32_t& uiMembers, std::vector<std::string>& vecKeys)
+{
+    std::string     strDocument = "{\"wide\": {";
+    std::mt19937_64 random(42);
+
+    vecKeys.clear();
+    for(uint32_t uiCnt = 0; uiCnt < uiMembers; ++uiCnt)
+    {
+        std::string strKey = "member_" + std::to_string(uiCnt);
+        strDocument += (uiCnt != 0)? ", ": "";
+        strDocument += "\"" + strKey + "\": " + std::to_string(uiCnt);
+        vecKeys.push_back(strKey);
+    }
+    strDocument += "}}";
+    std::shuffle(vecKeys.begin(), vecKeys.end(), random);
+
+    // Return processing result
+    return strDocument;
+}
+
+/**
+ * @brief Measure the lookups of a method, in ns per lookup
+ *
+ * @tparam tLookup Lookup type, bool lookup(const size_t& ulKey) (true if found)
+ * @param lookup Lookup of the key of an index
+ * @param ulKeys Key count
+ * @param iRet Processing result (-1 if a key is not found)
+ * @return double Processing result
+ */
+template<typename tLookup>
+static double measure(tLookup&& lookup, const size_t& ulKeys, int& iRet)
+{
+    auto start = std::chrono::steady_clock::now();
+    for(uint32_t uiCnt = 0; uiCnt < BENCH_LOOKUPS; ++uiCnt)
+    {
+        iRet = lookup(uiCnt % ulKeys)? iRet: -1;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    // Return processing result
+    return std::chrono::duration<double, std::nano>(end - start).count() / BENCH_LOOKUPS;
+}
+
+/**
+ * @brief Compare the lookups in a wide object of a member count
+ *
+ * @param uiMembers Member count of the wide object
+ * @return int Processing result
+ */
+static int compare(const uint32_t& uiMembers)
+{
+    int                                        iRet        = 0;
+    std::vector<std::string>                   vecKeys;
+    std::string                                strDocument = generate(uiMembers, vecKeys);
+    ::rapidjson::Document                      docRaw;
+    utilities::rapidjson                       json;
+    std::vector<utilities::rapidjson::stPath>  vecPaths;
+    int                                        iValue      = 0;
+
+    // Plain rapidjson document
+    docRaw.Parse(strDocument.data(), strDocument.size());
+    if(docRaw.HasParseError())
+    {
+        iRet = -1;
+    }
+    const ::rapidjson::Value& wide = docRaw["wide"];
+    double dHasMember  = measure([&](const size_t& ulKey) { return wide.HasMember(vecKeys[ulKey].c_str()); }, vecKeys.size(), iRet);
+    double dFindMember = measure([&](const size_t& ulKey) { return wide.FindMember(vecKeys[ulKey].c_str()) != wide.MemberEnd(); }, vecKeys.size(), iRet);
+
+    // This class, compiled paths without and with the member index
+    iRet |= json.set(strDocument.data(), strDocument.size());
+    for(const std::string& strKey : vecKeys)
+    {
+        vecPaths.push_back(json.compile("wide." + strKey));
+    }
+    json.index(0);
+    double dScan  = measure([&](const size_t& ulKey) { return json.get(iValue, vecPaths[ulKey]) == 0; }, vecPaths.size(), iRet);
+    json.index(BENCH_THRESHOLD);
+    double dIndex = measure([&](const size_t& ulKey) { return json.get(iValue, vecPaths[ulKey]) == 0; }, vecPaths.size(), iRet);
+
+    printf("%8u %12.1f %12.1f %12.1f %12.1f %8.1fx%s\n", uiMembers, dHasMember, dFindMember, dScan, dIndex, dScan / dIndex,
+           iRet? "  (lookup failed)": "");
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Benchmark entry point
+ *
+ * @return int Processing result
+ */
+int main()
+{
+    int iRet = 0;
+
+    printf("%8s %12s %12s %12s %12s %9s\n", "members", "HasMember", "FindMember", "index(0)", "index(N)", "speedup");
+    for(const uint32_t uiMembers : {1000U, 4000U, 16000U, 64000U})
+    {
+        iRet |= compare(uiMembers);
+    }
+    printf("ns per lookup, N = %u\n", BENCH_THRESHOLD);
+
+    // Return processing result
+    return iRet? 1: 0;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file bench_parse.cpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief set() throughput in GB/s and ULP error of the parsed doubles against
+ *        strtod, fast number parse against bFullPrecision
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "rapidjson.hpp"
+
+
+#define BENCH_BYTES  (256ULL * 1024 * 1024)
+#define BENCH_VALUES 200000
+
+
+/**
+ * @brief Generate a document of random doubles, half written with 17
+ *        significant digits (round trip) and half with 6
+ *
+ * @param vecTexts Texts of the values
+ * @return std::string JSON document
+ */
+static std::string generate(std::vector<std::string>& vecTexts)
+{
+    std::string     strDocument = "{\"values\": [";
+    std::mt19937_64 random(42);
+    char            acText[32];
+
+    while(vecTexts.size() < BENCH_VALUES)
+    {
+        uint64_t ulBits = random();
+        double   dValue = 0;
+        memcpy(&dValue, &ulBits, sizeof(dValue));
+        if(std::isfinite(dValue))
+        {
+            snprintf(acText, sizeof(acText), (vecTexts.size() % 2)? "%.6g": "%.17g", dValue);
+            strDocument += vecTexts.empty()? "": ",";
+            strDocument += acText;
+            vecTexts.push_back(acText);
+        }
+    }
+    strDocument += "]}";
+
+    // Return processing result
+    return strDocument;
+}
+
+/**
+ * @brief Distance in units in the last place between two doubles
+ *
+ * @param dFirst First value
+ * @param dSecond Second value
+ * @return uint64_t Processing result
+ */
+static uint64_t ulp(const double& dFirst, const double& dSecond)
+{
+    int64_t lFirst  = 0;
+    int64_t lSecond = 0;
+
+    memcpy(&lFirst, &dFirst, sizeof(lFirst));
+    memcpy(&lSecond, &dSecond, sizeof(lSecond));
+    // Order the negative values below the positive ones
+    lFirst  = (lFirst < 0)? INT64_MIN - lFirst: lFirst;
+    lSecond = (lSecond < 0)? INT64_MIN - lSecond: lSecond;
+
+    // Return processing result
+    return (lFirst > lSecond)? static_cast<uint64_t>(lFirst) - static_cast<uint64_t>(lSecond): static_cast<uint64_t>(lSecond) - static_cast<uint64_t>(lFirst);
+}
+
+/**
+ * @brief Measure the throughput and the accuracy of a parse mode
+ *
+ * @param strDocument JSON document
+ * @param vecTexts Texts of the values
+ * @param pcName Mode name
+ * @param bFullPrecision Full precision number parse
+ * @return int Processing result
+ */
+static int measure(const std::string& strDocument, const std::vector<std::string>& vecTexts, const char* pcName, const bool& bFullPrecision)
+{
+    int                                 iRet         = 0;
+    uint64_t                            ulIterations = std::max<uint64_t>(1, BENCH_BYTES / strDocument.size());
+    uint64_t                            ulMaxUlp     = 0;
+    uint64_t                            ulInexact    = 0;
+    utilities::rapidjson                json;
+    utilities::rapidjson::stParseConfig parseConfig;
+    std::vector<double>                 vecValues;
+
+    parseConfig.bFullPrecision = bFullPrecision;
+    json.parser(parseConfig);
+    auto start = std::chrono::steady_clock::now();
+    for(uint64_t ulCnt = 0; ulCnt < ulIterations; ++ulCnt)
+    {
+        iRet |= json.set(strDocument.data(), strDocument.size());
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    // Accuracy against strtod (correctly rounded)
+    iRet |= json.get(vecValues, "values");
+    if(vecValues.size() != vecTexts.size())
+    {
+        iRet = -1;
+    }
+    for(size_t ulCnt = 0; (!iRet) && (ulCnt < vecValues.size()); ++ulCnt)
+    {
+        uint64_t ulError = ulp(vecValues[ulCnt], strtod(vecTexts[ulCnt].c_str(), nullptr));
+        ulMaxUlp   = std::max(ulMaxUlp, ulError);
+        ulInexact += (ulError != 0)? 1: 0;
+    }
+    double dSeconds = std::chrono::duration<double>(end - start).count();
+    printf("%-16s %10.3f %12llu %12llu%s\n", pcName, static_cast<double>(strDocument.size()) * ulIterations / dSeconds / 1e9,
+           static_cast<unsigned long long>(ulInexact), static_cast<unsigned long long>(ulMaxUlp), iRet? "  (parse failed)": "");
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Benchmark entry point
+ *
+ * @return int Processing result
+ */
+int main()
+{
+    int                      iRet = 0;
+    std::vector<std::string> vecTexts;
+    std::string              strDocument = generate(vecTexts);
+
+    printf("%zu doubles, %zu bytes\n", vecTexts.size(), strDocument.size());
+    printf("%-16s %10s %12s %12s\n", "mode", "GB/s", "inexact", "max ulp");
+    iRet |= measure(strDocument, vecTexts, "default", false);
+    iRet |= measure(strDocument, vecTexts, "full precision", true);
+
+    // Return processing result
+    return iRet? 1: 0;
+}
@@ -0,0 +1,605 @@
+/**
+ * @file bench_path.cpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief get() latency per scalar type: string path against compiled path, and
+ *        element dispatch before (runtime type switch) and after if constexpr
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include "rapidjson.hpp"
+
+
+#define BENCH_ITERATIONS 1000000
+
+
+/**
+ * @brief Document read by the benchmark, the values sit three levels deep
+ */
+static const char* s_pcDocument =
+    "{\"bench\": {\"level1\": {\"level2\": {"
+    "\"i\": -123456, \"u64\": 12345678901234, \"u32\": 4000000000, \"u16\": 65000, \"u8\": 250, "
+    "\"i64\": -12345678901234, \"i16\": -32000, \"i8\": -120, \"f\": 1.5, \"d\": 3.141592653589793, "
+    "\"b\": true, \"s\": \"configuration value\"}}}}";
+
+/**
+ * @brief Measure the get() latency of a type with a string and a compiled path
+ *
+ * @tparam T_VALUE Value type
+ * @param json JSON document
+ * @param strNode JSON node path
+ * @param pcName Type name
+ * @return int Processing result
+ */
+template<typename T_VALUE>
+static int measure(const utilities::rapidjson& json, const std::string& strNode, const char* pcName)
+{
+    int                                  iRet   = 0;
+    const utilities::rapidjson::stPath   path   = json.compile(strNode);
+    T_VALUE                              tValue {};
+
+    auto start = std::chrono::steady_clock::now();
+    for(uint32_t uiCnt = 0; uiCnt < BENCH_ITERATIONS; ++uiCnt)
+    {
+        iRet |= json.get(tValue, strNode);
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for(uint32_t uiCnt = 0; uiCnt < BENCH_ITERATIONS; ++uiCnt)
+    {
+        iRet |= json.get(tValue, path);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double dString   = std::chrono::duration<double, std::nano>(middle - start).count() / BENCH_ITERATIONS;
+    double dCompiled = std::chrono::duration<double, std::nano>(end - middle).count() / BENCH_ITERATIONS;
+    printf("%-12s %12.1f %12.1f %8.1fx%s\n", pcName, dString, dCompiled, dString / dCompiled, iRet? "  (get failed)": "");
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Get the type of a node, as done before the if constexpr dispatch
+ *
+ * @param jsonObject object of the json file
+ * @return JSON_TYPE type of node
+ */
+static utilities::rapidjson::TYPE baselineType(const ::rapidjson::Value& jsonObject)
+{
+    utilities::rapidjson::TYPE eType = utilities::rapidjson::TYPE::UKNOWN;
+
+    // Get the type of the node 
+    switch (jsonObject.GetType())
+    {
+        case ::rapidjson::kArrayType:
+            eType = utilities::rapidjson::TYPE::ARRAY;
+            break;
+        case ::rapidjson::kObjectType:
+            eType = utilities::rapidjson::TYPE::OBJECT;
+            break;
+        case ::rapidjson::kTrueType:
+        case ::rapidjson::kFalseType:
+            eType = utilities::rapidjson::TYPE::BOOL;
+            break;
+        case ::rapidjson::kStringType:
+            eType = utilities::rapidjson::TYPE::STRING;
+            break;
+        case ::rapidjson::kNumberType:
+            if(jsonObject.IsInt())
+            {
+                eType = utilities::rapidjson::TYPE::SINT32;
+            }
+            else if (jsonObject.IsUint())
+            {
+                eType = utilities::rapidjson::TYPE::UINT32;
+            }
+            else if (jsonObject.IsInt64())
+            {
+                eType = utilities::rapidjson::TYPE::SINT64;
+            }
+            else if (jsonObject.IsUint64())
+            {
+                eType = utilities::rapidjson::TYPE::UINT64;
+            }
+            else if (jsonObject.IsFloat())
+            {
+                eType = utilities::rapidjson::TYPE::FLOAT;
+            }
+            else if (jsonObject.IsDouble())
+            {
+                eType = utilities::rapidjson::TYPE::DOUBLE;
+            }
+            
+            break;
+        
+        default:
+            break;
+    }
+
+    // Return processing result (node type)
+    return eType;
+
+}
+
+/**
+ * @brief Get an element with the runtime type switch of the baseline, kept
+ *        as the reference of the dispatch benchmark
+ *
+ * @tparam T_VALUE 
+ * @param jsonObject object of the json file
+ * @param tValue Value to retrieve
+ * @return  int processing result
+ */
+template<typename T_VALUE>
+static int baselineElement(const ::rapidjson::Value& jsonObject, T_VALUE& tValue)
+{
+    int iRet = 0;
+    // Get the type of the node in the json file
+    utilities::rapidjson::TYPE eType = baselineType(jsonObject);
+    // Get elemnt depends on its data type
+    switch (eType)
+    {
+        case utilities::rapidjson::TYPE::STRING:
+          {
+            if(std::is_same<T_VALUE, std::string>::value)
+            {   // Get string element
+                std::string& strValue = reinterpret_cast<std::string&>(tValue);   
+                strValue = jsonObject.GetString();
+            }
+            else
+            {
+                iRet = -2;
+            }
+            break;
+          }
+        case utilities::rapidjson::TYPE::BOOL:
+            if(std::is_same<T_VALUE, bool>::value)
+            {   // Get bool element
+                tValue = jsonObject.GetBool();
+            }
+            else
+            {
+                iRet = -2;
+            }
+            break;
+        case utilities::rapidjson::TYPE::FLOAT:
+            if (jsonObject.IsFloat() && std::is_same<T_VALUE, float>::value)
+            {   // Get float element
+                tValue = jsonObject.GetFloat();
+            }
+            else if (jsonObject.IsDouble() && std::is_same<T_VALUE, double>::value)
+            {   // Get double element
+                tValue = jsonObject.GetDouble();
+            }
+            else
+            {
+                iRet = -2;
+            }
+            break;
+        case utilities::rapidjson::TYPE::SINT32:
+            {
+                int32_t  iValue = jsonObject.GetInt();
+                uint32_t uiValue = 0;
+                if(jsonObject.GetInt() >= 0)
+                {
+                    uiValue = jsonObject.GetUint();
+                }
+                if(std::is_same<T_VALUE, uint32_t>::value)
+                {  
+                    if((iValue >= 0) && (uiValue <= UINT32_MAX))
+                    {   // Get uint23_t element
+                        tValue = static_cast<uint32_t>(uiValue);
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }   
+                }
+                else if (std::is_same<T_VALUE, uint16_t>::value)
+                {   
+                    if((iValue >= 0) && (uiValue <= UINT16_MAX))
+                    {
+                        // Get uint16 element
+                        tValue = static_cast<uint16_t>(uiValue);
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }   
+                }
+                else if (std::is_same<T_VALUE, uint8_t>::value)
+                {   
+                    if((iValue >= 0) && (uiValue <= UINT8_MAX))
+                    {
+                        // Get uint16 element
+                        tValue = static_cast<uint8_t>(uiValue);
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }   
+                }
+                else if(std::is_same<T_VALUE, int>::value)
+                {  
+                    if(iValue <= INT_MAX && iValue >= INT_MIN)
+                    {
+                        // Get int element
+                        tValue = static_cast<int>(iValue);
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }   
+                }
+                else if (std::is_same<T_VALUE, int8_t>::value)
+                {   
+                    if (iValue <= INT8_MAX && iValue >= INT8_MIN)
+                    {
+                        // Get int16_t element
+                        tValue = static_cast<int8_t>(iValue);
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }   
+                }
+                else if (std::is_same<T_VALUE, int16_t>::value)
+                {   
+                    if (iValue <= INT16_MAX && iValue >= INT16_MIN)
+                    {
+                        // Get int16_t element
+                        tValue = static_cast<int16_t>(iValue);
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }   
+                }
+                else if (std::is_same<T_VALUE, int32_t>::value)
+                {  
+                    if (iValue <= INT32_MAX && iValue >= INT32_MIN)
+                    {
+                        // Get int32_t element
+                        tValue = static_cast<int32_t>(iValue);
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }  
+                }
+                else if (std::is_same<T_VALUE, int64_t>::value)
+                {   // Get int64 element
+                    tValue = jsonObject.GetInt64();
+                }
+                else if (std::is_same<T_VALUE, uint64_t>::value)
+                {   
+                    if (jsonObject.GetInt64() >= 0)
+                    {
+                        // Get uint16 element
+                        tValue = jsonObject.GetUint64();
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }
+                }
+                else if (std::is_same<T_VALUE, float>::value)
+                {   // Get float element
+                    tValue = jsonObject.GetFloat();
+                }
+                else if (std::is_same<T_VALUE, double>::value)
+                {   // Get double element
+                    tValue = jsonObject.GetDouble();
+                }
+                else
+                {
+                    iRet = -2;
+                }
+                break;
+            }
+        case utilities::rapidjson::TYPE::SINT64:
+            if (std::is_same<T_VALUE, int64_t>::value)
+            {   // Get int64 element
+                tValue = jsonObject.GetInt64();
+            }
+            else if (std::is_same<T_VALUE, uint64_t>::value)
+            {   
+                if (jsonObject.GetInt64() >= 0)
+                {
+                    // Get uint16 element
+                    tValue = jsonObject.GetUint64();
+                }
+                else
+                {
+                    iRet = -2;
+                }
+            }
+            else
+            {
+                iRet = -2;
+            }
+            break;
+        case utilities::rapidjson::TYPE::UINT32:
+           {
+                uint32_t uiValue  = jsonObject.GetUint();
+                if(std::is_same<T_VALUE, uint32_t>::value)
+                {  
+                    if(uiValue <= UINT32_MAX)
+                    {   // Get uint23_t element
+                        tValue = static_cast<uint32_t>(uiValue);
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }   
+                }
+                else if (std::is_same<T_VALUE, uint16_t>::value)
+                {   
+                    if(uiValue <= UINT16_MAX)
+                    {
+                        // Get uint16 element
+                        tValue = static_cast<uint16_t>(uiValue);
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }   
+                }
+                else if (std::is_same<T_VALUE, uint8_t>::value)
+                {   
+                    if(uiValue <= UINT8_MAX)
+                    {
+                        // Get uint16 element
+                        tValue = static_cast<uint8_t>(uiValue);
+                    }
+                    else
+                    {
+                        iRet = -2;
+                    }   
+                }
+                break;
+           }
+        case utilities::rapidjson::TYPE::UINT64:
+            tValue = jsonObject.GetUint64();
+            break;
+        case utilities::rapidjson::TYPE::DOUBLE:
+            tValue = jsonObject.GetDouble();
+            break;
+        default:
+            iRet = -1;
+            break;
+    }
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Get an element with the if constexpr dispatch (copy of rapidjson::element)
+ *
+ * @tparam T_VALUE 
+ * @param jsonObject object of the json file
+ * @param tValue Value to retrieve
+ * @return int Processing result
+ */
+template<typename T_VALUE>
+static int currentElement(const ::rapidjson::Value& jsonObject, T_VALUE& tValue)
+{
+    int iRet = 0;
+
+    // Each instantiation only checks its own data type and range
+    if constexpr (std::is_same<T_VALUE, std::string>::value)
+    {   // Get string element
+        if(jsonObject.IsString())
+        {
+            tValue.assign(jsonObject.GetString(), jsonObject.GetStringLength());
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+    else if constexpr (std::is_same<T_VALUE, std::string_view>::value)
+    {   // Get string element as a view of the document
+        if(jsonObject.IsString())
+        {
+            tValue = std::string_view(jsonObject.GetString(), jsonObject.GetStringLength());
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+    else if constexpr (std::is_same<T_VALUE, bool>::value)
+    {   // Get bool element
+        if(jsonObject.IsBool())
+        {
+            tValue = jsonObject.GetBool();
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+    else if constexpr (std::is_floating_point<T_VALUE>::value)
+    {   // Get float / double element from any number (float: within its range)
+        if(jsonObject.IsNumber())
+        {
+            double dValue = jsonObject.GetDouble();
+            if constexpr (std::is_same<T_VALUE, float>::value)
+            {   // A finite double out of the float range can not be narrowed
+                if((std::isfinite(dValue)) && 
+                   (std::fabs(dValue) > std::numeric_limits<float>::max()))
+                {
+                    iRet = -2;
+                }
+            }
+            if(!iRet)
+            {
+                tValue = static_cast<T_VALUE>(dValue);
+            }
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+    else if constexpr (std::is_signed<T_VALUE>::value)
+    {   // Get signed int element within its range
+        if(jsonObject.IsInt64())
+        {
+            int64_t lValue = jsonObject.GetInt64();
+            if constexpr (sizeof(T_VALUE) < sizeof(int64_t))
+            {
+                if((lValue < std::numeric_limits<T_VALUE>::min()) || 
+                   (lValue > std::numeric_limits<T_VALUE>::max()))
+                {
+                    iRet = -2;
+                }
+            }
+            if(!iRet)
+            {
+                tValue = static_cast<T_VALUE>(lValue);
+            }
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+    else
+    {   // Get unsigned int element within its range
+        if(jsonObject.IsUint64())
+        {
+            uint64_t ulValue = jsonObject.GetUint64();
+            if constexpr (sizeof(T_VALUE) < sizeof(uint64_t))
+            {
+                if(ulValue > std::numeric_limits<T_VALUE>::max())
+                {
+                    iRet = -2;
+                }
+            }
+            if(!iRet)
+            {
+                tValue = static_cast<T_VALUE>(ulValue);
+            }
+        }
+        else
+        {
+            iRet = -2;
+        }
+    }
+
+    if((iRet) && 
+       (!jsonObject.IsString()) && 
+       (!jsonObject.IsBool()) && 
+       (!jsonObject.IsNumber()))
+    {   // Not a data type node
+        iRet = -1;
+    }
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Measure the element dispatch latency of a type, baseline against if constexpr
+ *
+ * @tparam T_VALUE Value type
+ * @param jsonObject Node of the value
+ * @param pcName Type name
+ * @return int Processing result
+ */
+template<typename T_VALUE>
+static int dispatch(const ::rapidjson::Value& jsonObject, const char* pcName)
+{
+    int     iRet   = 0;
+    T_VALUE tValue {};
+
+    auto start = std::chrono::steady_clock::now();
+    for(uint32_t uiCnt = 0; uiCnt < BENCH_ITERATIONS; ++uiCnt)
+    {
+        iRet |= baselineElement(jsonObject, tValue);
+        // Keep the read in the loop
+        asm volatile("" : : "g"(&tValue) : "memory");
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for(uint32_t uiCnt = 0; uiCnt < BENCH_ITERATIONS; ++uiCnt)
+    {
+        iRet |= currentElement(jsonObject, tValue);
+        asm volatile("" : : "g"(&tValue) : "memory");
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double dBaseline = std::chrono::duration<double, std::nano>(middle - start).count() / BENCH_ITERATIONS;
+    double dCurrent  = std::chrono::duration<double, std::nano>(end - middle).count() / BENCH_ITERATIONS;
+    printf("%-12s %12.1f %12.1f %8.1fx%s\n", pcName, dBaseline, dCurrent, dBaseline / dCurrent, iRet? "  (get failed)": "");
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Benchmark entry point
+ *
+ * @return int Processing result
+ */
+int main()
+{
+    int                   iRet = 0;
+    utilities::rapidjson  json;
+    ::rapidjson::Document docBench;
+
+    if(json.set(std::string(s_pcDocument)) != 0)
+    {
+        printf("document parse failed\n");
+        iRet = -1;
+    }
+    else
+    {
+        printf("%-12s %12s %12s %9s\n", "type", "string ns", "compiled ns", "speedup");
+        iRet |= measure<int>(json, "bench.level1.level2.i", "int");
+        iRet |= measure<uint64_t>(json, "bench.level1.level2.u64", "uint64_t");
+        iRet |= measure<uint32_t>(json, "bench.level1.level2.u32", "uint32_t");
+        iRet |= measure<uint16_t>(json, "bench.level1.level2.u16", "uint16_t");
+        iRet |= measure<uint8_t>(json, "bench.level1.level2.u8", "uint8_t");
+        iRet |= measure<int64_t>(json, "bench.level1.level2.i64", "int64_t");
+        iRet |= measure<int16_t>(json, "bench.level1.level2.i16", "int16_t");
+        iRet |= measure<int8_t>(json, "bench.level1.level2.i8", "int8_t");
+        iRet |= measure<float>(json, "bench.level1.level2.f", "float");
+        iRet |= measure<double>(json, "bench.level1.level2.d", "double");
+        iRet |= measure<bool>(json, "bench.level1.level2.b", "bool");
+        iRet |= measure<std::string>(json, "bench.level1.level2.s", "string");
+        iRet |= measure<std::string_view>(json, "bench.level1.level2.s", "string_view");
+    }
+    if(docBench.Parse(s_pcDocument).HasParseError())
+    {
+        iRet = -1;
+    }
+    else
+    {   // Element dispatch on the same nodes (the baseline has no string_view)
+        const ::rapidjson::Value& level2 = docBench["bench"]["level1"]["level2"];
+        printf("\n%-12s %12s %12s %9s\n", "type", "switch ns", "constexpr ns", "speedup");
+        iRet |= dispatch<int>(level2["i"], "int");
+        iRet |= dispatch<uint64_t>(level2["u64"], "uint64_t");
+        iRet |= dispatch<uint32_t>(level2["u32"], "uint32_t");
+        iRet |= dispatch<uint16_t>(level2["u16"], "uint16_t");
+        iRet |= dispatch<uint8_t>(level2["u8"], "uint8_t");
+        iRet |= dispatch<int64_t>(level2["i64"], "int64_t");
+        iRet |= dispatch<int16_t>(level2["i16"], "int16_t");
+        iRet |= dispatch<int8_t>(level2["i8"], "int8_t");
+        iRet |= dispatch<float>(level2["f"], "float");
+        iRet |= dispatch<double>(level2["d"], "double");
+        iRet |= dispatch<bool>(level2["b"], "bool");
+        iRet |= dispatch<std::string>(level2["s"], "string");
+    }
+
+    // Return processing result
+    return iRet? 1: 0;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file bench_save.cpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief save() throughput of a 100 MB document, atomic and in place, with
+ *        each sync mode (bench_save [directory], the current one by default)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+#include "rapidjson.hpp"
+
+
+#define BENCH_DOCUMENT_BYTES (100ULL * 1024 * 1024)
+#define BENCH_ITERATIONS     3
+
+
+/**
+ * @brief Generate a document of about BENCH_DOCUMENT_BYTES bytes: records of
+ *        strings and numbers
+ *
+ * @return std::string JSON document
+ */
+static std::string generate()
+{
+    std::string strDocument = "{\"records\": [";
+
+    for(uint64_t ulCnt = 0; strDocument.size() < BENCH_DOCUMENT_BYTES; ++ulCnt)
+    {
+        strDocument += (ulCnt != 0)? ",": "";
+        strDocument += "{\"id\": " + std::to_string(ulCnt) + ", \"name\": \"record " + std::to_string(ulCnt) + "\", "
+                       "\"ratio\": " + std::to_string(ulCnt * 0.001) + ", \"enabled\": " + ((ulCnt % 2)? "true": "false") + ", "
+                       "\"values\": [1, 2, 3, 4.5, -6e3, null]}";
+    }
+    strDocument += "]}";
+
+    // Return processing result
+    return strDocument;
+}
+
+/**
+ * @brief Measure the save() throughput of a configuration
+ *
+ * @param json Document to save
+ * @param strFile Saved file path
+ * @param bAtomic Atomic save
+ * @param eSync Sync mode
+ * @param pcSync Sync mode name
+ * @return int Processing result
+ */
+static int measure(utilities::rapidjson& json, const std::string& strFile, const bool& bAtomic,
+                   const utilities::rapidjson::stSaveConfig::SYNC& eSync, const char* pcSync)
+{
+    int                                iRet   = 0;
+    utilities::rapidjson::stSaveConfig saveConfig;
+    double                             dBest  = 0;
+    off_t                              lBytes = 0;
+
+    saveConfig.bAtomic        = bAtomic;
+    saveConfig.eSync          = eSync;
+    saveConfig.format.eFormat = utilities::rapidjson::FORMAT::COMPACT;
+    for(uint32_t uiCnt = 0; uiCnt < BENCH_ITERATIONS; ++uiCnt)
+    {
+        auto start = std::chrono::steady_clock::now();
+        iRet |= json.save(strFile, saveConfig);
+        auto end = std::chrono::steady_clock::now();
+        double dSeconds = std::chrono::duration<double>(end - start).count();
+        dBest = ((uiCnt == 0) || (dSeconds < dBest))? dSeconds: dBest;
+    }
+    // Size of the saved file
+    FILE* pFile = fopen(strFile.c_str(), "rb");
+    if(pFile != nullptr)
+    {
+        fseeko(pFile, 0, SEEK_END);
+        lBytes = ftello(pFile);
+        fclose(pFile);
+    }
+    printf("%-10s %-6s %10lld %10.3f %10.1f%s\n", bAtomic? "atomic": "in place", pcSync, static_cast<long long>(lBytes),
+           dBest * 1e3, static_cast<double>(lBytes) / dBest / 1e6, iRet? "  (save failed)": "");
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Benchmark entry point
+ *
+ * @param iArgc Number of arguments
+ * @param ppcArgv Arguments (directory of the saved file)
+ * @return int Processing result
+ */
+int main(int iArgc, char** ppcArgv)
+{
+    int                  iRet        = 0;
+    std::string          strFile     = std::string((iArgc > 1)? ppcArgv[1]: ".") + "/bench_save.json";
+    std::string          strDocument = generate();
+    utilities::rapidjson json;
+
+    iRet = json.set(strDocument.data(), strDocument.size());
+    strDocument.clear();
+    strDocument.shrink_to_fit();
+    printf("%-10s %-6s %10s %10s %10s\n", "save", "sync", "bytes", "best ms", "MB/s");
+    for(const bool bAtomic : {false, true})
+    {
+        iRet |= measure(json, strFile, bAtomic, utilities::rapidjson::stSaveConfig::SYNC::NONE, "none");
+        iRet |= measure(json, strFile, bAtomic, utilities::rapidjson::stSaveConfig::SYNC::DATA, "data");
+        iRet |= measure(json, strFile, bAtomic, utilities::rapidjson::stSaveConfig::SYNC::FULL, "full");
+    }
+    unlink(strFile.c_str());
+
+    // Return processing result
+    return iRet? 1: 0;
+}
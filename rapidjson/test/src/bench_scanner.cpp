@@ -0,0 +1,129 @@
+/**
+ * @file bench_scanner.cpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief set() throughput in GB/s, READER against SIMD with each kernel
+ *        (bench_scanner [file.json ...], a generated corpus without files)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "rapidjson.hpp"
+#include "scanner.hpp"
+
+
+#define BENCH_BYTES   (512ULL * 1024 * 1024)
+#define BENCH_RECORDS 20000
+
+
+/**
+ * @brief Generate a corpus document: records of strings, numbers and escapes
+ *
+ * @return std::string JSON document
+ */
+static std::string generate()
+{
+    std::string strDocument = "{\"records\": [";
+
+    for(uint32_t uiCnt = 0; uiCnt < BENCH_RECORDS; ++uiCnt)
+    {
+        strDocument += (uiCnt != 0)? ",\n": "\n";
+        strDocument += "  {\"id\": " + std::to_string(uiCnt) + ", \"name\": \"record " + std::to_string(uiCnt) + "\", "
+                       "\"path\": \"C:\\\\data\\\\file.bin\", \"note\": \"quoted \\\"text\\\" \\u00e9\", "
+                       "\"ratio\": " + std::to_string(uiCnt * 0.001) + ", \"enabled\": " + ((uiCnt % 2)? "true": "false") + ", "
+                       "\"values\": [1, 2, 3, 4.5, -6e3, null]}";
+    }
+    strDocument += "\n]}";
+
+    // Return processing result
+    return strDocument;
+}
+
+/**
+ * @brief Measure the set() throughput of a parse front-end on a text
+ *
+ * @param strText JSON text
+ * @param eParser Parse front-end
+ * @param dThroughput Throughput in GB/s
+ * @return int Processing result
+ */
+static int measure(const std::string& strText, const utilities::rapidjson::PARSER& eParser, double& dThroughput)
+{
+    int                  iRet         = 0;
+    uint64_t             ulIterations = std::max<uint64_t>(1, BENCH_BYTES / std::max<size_t>(1, strText.size()));
+    utilities::rapidjson json;
+
+    json.parser(eParser);
+    auto start = std::chrono::steady_clock::now();
+    for(uint64_t ulCnt = 0; ulCnt < ulIterations; ++ulCnt)
+    {
+        iRet |= json.set(strText.data(), strText.size());
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double dSeconds = std::chrono::duration<double>(end - start).count();
+    dThroughput = static_cast<double>(strText.size()) * ulIterations / dSeconds / 1e9;
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Benchmark entry point
+ *
+ * @param iArgc Number of arguments
+ * @param ppcArgv Arguments (corpus files)
+ * @return int Processing result
+ */
+int main(int iArgc, char** ppcArgv)
+{
+    int                                              iRet = 0;
+    std::vector<std::pair<std::string, std::string>> vecCorpus;
+
+    // Corpus files, or a generated document
+    for(int iCnt = 1; iCnt < iArgc; ++iCnt)
+    {
+        std::ifstream     fileStream(ppcArgv[iCnt], std::ios::binary);
+        std::stringstream textStream;
+        textStream << fileStream.rdbuf();
+        if(!fileStream)
+        {
+            printf("can not read %s\n", ppcArgv[iCnt]);
+            iRet = -1;
+        }
+        else
+        {
+            vecCorpus.emplace_back(ppcArgv[iCnt], textStream.str());
+        }
+    }
+    if(iArgc < 2)
+    {
+        vecCorpus.emplace_back("generated", generate());
+    }
+    printf("%-32s %10s %-8s %10s\n", "file", "bytes", "parser", "GB/s");
+    for(const std::pair<std::string, std::string>& pairFile : vecCorpus)
+    {
+        double dThroughput = 0;
+        int    iMeasure    = measure(pairFile.second, utilities::rapidjson::PARSER::READER, dThroughput);
+        printf("%-32s %10zu %-8s %10.3f%s\n", pairFile.first.c_str(), pairFile.second.size(), "reader", dThroughput, iMeasure? "  (parse failed)": "");
+        iRet |= iMeasure;
+        for(const std::string& strKernel : utilities::scanner::kernels())
+        {
+            utilities::scanner::kernel(strKernel);
+            iMeasure = measure(pairFile.second, utilities::rapidjson::PARSER::SIMD, dThroughput);
+            printf("%-32s %10zu %-8s %10.3f%s\n", pairFile.first.c_str(), pairFile.second.size(), strKernel.c_str(), dThroughput, iMeasure? "  (parse failed)": "");
+            iRet |= iMeasure;
+        }
+    }
+
+    // Return processing result
+    return iRet? 1: 0;
+}
@@ -0,0 +1,279 @@
+/**
+ * @file test_concurrent.cpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief Concurrent const reads and holder snapshots stress test, run it
+ *        under ThreadSanitizer (make test SANITIZE=thread)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "holder.hpp"
+#include "rapidjson.hpp"
+
+
+#define TEST_THREADS     8
+#define TEST_ITERATIONS  20000
+#define TEST_MEMBERS     64
+#define TEST_THRESHOLD   16
+#define TEST_PUBLISHES   2000
+
+
+/**
+ * @brief Build a document with a wide object (member index) and an array
+ *
+ * @return std::string JSON document
+ */
+static std::string document()
+{
+    std::string strDocument = "{\"wide\": {";
+
+    for(uint32_t uiCnt = 0; uiCnt < TEST_MEMBERS; ++uiCnt)
+    {
+        strDocument += (uiCnt != 0)? ", ": "";
+        strDocument += "\"m" + std::to_string(uiCnt) + "\": " + std::to_string(uiCnt);
+    }
+    strDocument += "}, \"list\": [1, 2, 3, 4, 5], \"nested\": {\"name\": \"value\", \"ratio\": 0.5}}";
+
+    // Return processing result
+    return strDocument;
+}
+
+/**
+ * @brief Read the document from several threads at once
+ *
+ * Every thread reads through string and compiled paths, so the member index
+ * of the wide object and the lazy nodes are built while other threads read.
+ *
+ * @param json JSON document
+ * @param bMaterialize One thread also serializes the whole document
+ * @return uint32_t Number of failed reads
+ */
+static uint32_t stress(const utilities::rapidjson& json, const bool& bMaterialize)
+{
+    std::atomic<uint32_t>    uiFailures {0};
+    std::vector<std::thread> vecThreads;
+
+    for(uint32_t uiThread = 0; uiThread < TEST_THREADS; ++uiThread)
+    {
+        vecThreads.emplace_back([&json, &uiFailures, &bMaterialize, uiThread]()
+        {
+            const utilities::rapidjson::stPath pathRatio = json.compile("nested.ratio");
+            for(uint32_t uiCnt = 0; uiCnt < TEST_ITERATIONS; ++uiCnt)
+            {
+                uint32_t              uiMember = (uiCnt + uiThread) % TEST_MEMBERS;
+                int                   iValue   = -1;
+                double                dRatio   = 0;
+                std::string           strName;
+                std::vector<uint32_t> vecList;
+                if((json.get(iValue, "wide.m" + std::to_string(uiMember)) != 0) ||
+                   (iValue != static_cast<int>(uiMember)) ||
+                   (json.get(dRatio, pathRatio) != 0) ||
+                   (dRatio != 0.5) ||
+                   (json.get(strName, "nested.name") != 0) ||
+                   (strName != "value") ||
+                   (json.get(vecList, "list") != 0) ||
+                   (vecList.size() != 5) ||
+                   (!json.exist("wide.m0")) ||
+                   (json.exist("wide.missing")) ||
+                   (json.size("list") != 5) ||
+                   (json.getType("nested") != utilities::rapidjson::TYPE::OBJECT))
+                {
+                    uiFailures++;
+                }
+                if((bMaterialize) &&
+                   (uiThread == 0) &&
+                   (uiCnt == TEST_ITERATIONS / 2))
+                {   // Full parse of a lazy document while the others read
+                    std::string strOut;
+                    utilities::rapidjson::stFormat format;
+                    if(json.get(strOut, format) != 0)
+                    {
+                        uiFailures++;
+                    }
+                }
+            }
+        });
+    }
+    for(std::thread& thread : vecThreads)
+    {
+        thread.join();
+    }
+
+    // Return processing result
+    return uiFailures.load();
+}
+
+/**
+ * @brief Build a snapshot document holding its version twice
+ *
+ * @param uiVersion Snapshot version
+ * @return std::string JSON document
+ */
+static std::string snapshot(const uint32_t& uiVersion)
+{
+    std::string strVersion = std::to_string(uiVersion);
+
+    // Return processing result
+    return "{\"version\": " + strVersion + ", \"copy\": {\"version\": " + strVersion + "}, " + document().substr(1);
+}
+
+/**
+ * @brief Pin holder snapshots from several threads while another one
+ *        replaces them
+ *
+ * The writer alternates holder::load() of two files and publish() of parsed
+ * documents. A reader fails if the two versions of its pinned snapshot
+ * differ, or change while it is pinned.
+ *
+ * @param strFile Snapshot file path prefix
+ * @return uint32_t Number of failures
+ */
+static uint32_t stressHolder(const std::string& strFile)
+{
+    std::atomic<uint32_t>                   uiFailures {0};
+    std::atomic<bool>                       bDone      {false};
+    std::vector<std::thread>                vecThreads;
+    std::vector<std::string>                vecFiles   = {strFile + "_1.json", strFile + "_2.json"};
+    utilities::holder::stSnapshotConfig     snapshotConfig;
+
+    // Snapshot files of versions 1 and 2
+    for(uint32_t uiCnt = 0; uiCnt < vecFiles.size(); ++uiCnt)
+    {
+        FILE* pFile = fopen(vecFiles[uiCnt].c_str(), "w");
+        if((pFile == nullptr) ||
+           (fputs(snapshot(uiCnt + 1).c_str(), pFile) < 0) ||
+           (fclose(pFile) != 0))
+        {
+            uiFailures++;
+        }
+    }
+    snapshotConfig.uiIndex = TEST_THRESHOLD;
+    utilities::holder holderJson("", '.', snapshotConfig);
+    if(holderJson.load(vecFiles[0]) != 0)
+    {
+        uiFailures++;
+    }
+    for(uint32_t uiThread = 0; (!uiFailures) && (uiThread < TEST_THREADS); ++uiThread)
+    {
+        vecThreads.emplace_back([&holderJson, &uiFailures, &bDone, uiThread]()
+        {
+            for(uint32_t uiCnt = 0; !bDone.load(); ++uiCnt)
+            {
+                utilities::holder::reader pin      = holderJson.read();
+                uint32_t                  uiMember = (uiCnt + uiThread) % TEST_MEMBERS;
+                int                       iVersion = -1;
+                int                       iCopy    = -2;
+                int                       iValue   = -1;
+                if((pin->get(iVersion, "version") != 0) ||
+                   (pin->get(iCopy, "copy.version") != 0) ||
+                   (iVersion != iCopy) ||
+                   (pin->get(iValue, "wide.m" + std::to_string(uiMember)) != 0) ||
+                   (iValue != static_cast<int>(uiMember)) ||
+                   (pin->get(iCopy, "version") != 0) ||
+                   (iVersion != iCopy))
+                {
+                    uiFailures++;
+                }
+            }
+        });
+    }
+    // Replace the snapshot while the readers pin it
+    for(uint32_t uiCnt = 0; (!vecThreads.empty()) && (uiCnt < TEST_PUBLISHES); ++uiCnt)
+    {
+        if(uiCnt % 2)
+        {
+            std::unique_ptr<utilities::rapidjson> pJson(new utilities::rapidjson());
+            pJson->index(TEST_THRESHOLD);
+            if((pJson->set(snapshot(100 + uiCnt)) != 0) ||
+               (holderJson.publish(std::move(pJson)) != 0))
+            {
+                uiFailures++;
+            }
+        }
+        else if(holderJson.load(vecFiles[(uiCnt / 2) % 2]) != 0)
+        {
+            uiFailures++;
+        }
+    }
+    bDone = true;
+    for(std::thread& thread : vecThreads)
+    {
+        thread.join();
+    }
+    for(const std::string& strSnapshot : vecFiles)
+    {
+        unlink(strSnapshot.c_str());
+    }
+
+    // Return processing result
+    return uiFailures.load();
+}
+
+/**
+ * @brief Test entry point
+ *
+ * @return int Processing result
+ */
+int main()
+{
+    int                  iRet     = 0;
+    std::string          strFile  = "/tmp/test_concurrent_" + std::to_string(getpid()) + ".json";
+    utilities::rapidjson jsonParsed;
+    utilities::rapidjson jsonLazy(strFile);
+    FILE*                pFile    = fopen(strFile.c_str(), "w");
+
+    // Parsed document with member index
+    jsonParsed.index(TEST_THRESHOLD);
+    if(jsonParsed.set(document()) != 0)
+    {
+        printf("FAIL parse\n");
+        iRet = -1;
+    }
+    else if(stress(jsonParsed, false) != 0)
+    {
+        printf("FAIL concurrent reads of a parsed document\n");
+        iRet = -1;
+    }
+    // Lazy loaded document with member index
+    if((pFile == nullptr) ||
+       (fputs(document().c_str(), pFile) < 0) ||
+       (fclose(pFile) != 0))
+    {
+        printf("FAIL write %s\n", strFile.c_str());
+        iRet = -1;
+    }
+    else
+    {
+        jsonLazy.index(TEST_THRESHOLD);
+        if(jsonLazy.load(strFile, utilities::rapidjson::LOAD::LAZY) != 0)
+        {
+            printf("FAIL lazy load\n");
+            iRet = -1;
+        }
+        else if(stress(jsonLazy, true) != 0)
+        {
+            printf("FAIL concurrent reads of a lazy document\n");
+            iRet = -1;
+        }
+        unlink(strFile.c_str());
+    }
+    // Holder snapshots replaced while pinned
+    if(stressHolder("/tmp/test_concurrent_" + std::to_string(getpid())) != 0)
+    {
+        printf("FAIL concurrent pins of holder snapshots\n");
+        iRet = -1;
+    }
+    printf("%s test_concurrent\n", iRet? "FAIL": "PASS");
+
+    // Return processing result
+    return iRet? 1: 0;
+}
@@ -0,0 +1,212 @@
+/**
+ * @file test_scanner.cpp
+ * @author Meimoun Moalla (meimoun.moalla@technica-engineering.de)
+ * @brief Differential test of the SIMD front-end against the rapidjson reader,
+ *        with each kernel supported by the CPU forced in turn
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "rapidjson.hpp"
+#include "scanner.hpp"
+
+
+#define TEST_REPORTED 10
+
+
+/**
+ * @brief Test case
+ */
+struct stCase
+{
+    std::string strName;
+    std::string strText;
+    bool        bUtf8 {true};
+};
+
+/**
+ * @brief Add a test case
+ *
+ * @param vecCases Test cases
+ * @param strName Case name
+ * @param strText JSON text
+ * @param bUtf8 The text is valid UTF-8
+ */
+static void add(std::vector<stCase>& vecCases, const std::string& strName, const std::string& strText, const bool& bUtf8 = true)
+{
+    stCase testCase;
+    testCase.strName = strName;
+    testCase.strText = strText;
+    testCase.bUtf8   = bUtf8;
+    vecCases.push_back(testCase);
+}
+
+/**
+ * @brief Build the corpus: valid and invalid documents, escapes and backslash
+ *        runs across the 64 bytes blocks, invalid UTF-8 and truncated texts
+ *
+ * @return std::vector<stCase> Processing result
+ */
+static std::vector<stCase> corpus()
+{
+    std::vector<stCase> vecCases;
+    const char*         apcValid[] = {
+        "{\"a\":1,\"b\":[true,false,null,-2.5,\"x\\\"y\"],\"c\":{}}", "[]", "{}", " 42 ", "\"text\"", "-0", "0.5e-3",
+        "1E+2", "18446744073709551615", "-9223372036854775808", "123456789012345678901234567890",
+        "1.7976931348623157e308", "4.9e-324", "[1,{\"k\":[[],[{}]]}]", " \t\n\r[ 1 , 2 ] \n",
+        "\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"", "\"\\u00e9\\ud83d\\ude00\"", "\"\\u0000\"", "\"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\"",
+        "{\"\":\"\",\"a\\u0062\":[\"\"]}"};
+    const char*         apcInvalid[] = {
+        "", "   ", "[1,]", "{\"a\":1,}", "{\"a\" 1}", "[1 2]", "\"abc", "\"a\tb\"", "{}x", "[\"\\q\"]", "\"\\ud800\"",
+        "\"\\udc00\"", "\"\\u12\"", "01", "-", "1.", "1e", "tru", "nul", "[}", "{\"a\":}", "{1:2}", "[,1]", "NaN",
+        "Infinity", "[\"a\"\"b\"]", "{\"a\":1 \"b\":2}", "\"\\"};
+    const char*         apcUtf8[] = {
+        "\xc0\x80", "\xc1\xbf", "\xed\xa0\x80", "\xf5\x80\x80\x80", "\xf4\x90\x80\x80", "\x80", "\xbf", "\xc3",
+        "\xe2\x82", "\xf0\x9f\x98", "\xe0\x80\x80", "\xf0\x80\x80\x80", "\xfe", "\xff"};
+    const char*         apcSequences[] = {"\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80"};
+
+    for(uint32_t uiCnt = 0; uiCnt < sizeof(apcValid) / sizeof(apcValid[0]); ++uiCnt)
+    {
+        add(vecCases, "valid " + std::to_string(uiCnt), apcValid[uiCnt]);
+    }
+    for(uint32_t uiCnt = 0; uiCnt < sizeof(apcInvalid) / sizeof(apcInvalid[0]); ++uiCnt)
+    {
+        add(vecCases, "invalid " + std::to_string(uiCnt), apcInvalid[uiCnt]);
+    }
+    // Runs of backslashes ending on each side of the block boundaries, odd runs escape the quote
+    for(uint32_t uiPad = 0; uiPad < 140; ++uiPad)
+    {
+        for(uint32_t uiRun = 1; uiRun <= 6; ++uiRun)
+        {
+            std::string strText = "[\"" + std::string(uiPad, 'a') + std::string(uiRun, '\\') + "\"" + ((uiRun % 2)? "x\"": "") + "]";
+            add(vecCases, "backslashes " + std::to_string(uiPad) + "/" + std::to_string(uiRun), strText);
+            add(vecCases, "backslashes unterminated " + std::to_string(uiPad) + "/" + std::to_string(uiRun), strText.substr(0, strText.size() - 2));
+        }
+    }
+    // Multi-byte sequences across the block boundaries, and invalid UTF-8
+    for(uint32_t uiPad = 56; uiPad < 72; ++uiPad)
+    {
+        for(uint32_t uiCnt = 0; uiCnt < sizeof(apcSequences) / sizeof(apcSequences[0]); ++uiCnt)
+        {
+            add(vecCases, "utf8 " + std::to_string(uiPad) + "/" + std::to_string(uiCnt), "[\"" + std::string(uiPad, 'a') + apcSequences[uiCnt] + "\"]");
+        }
+        for(uint32_t uiCnt = 0; uiCnt < sizeof(apcUtf8) / sizeof(apcUtf8[0]); ++uiCnt)
+        {
+            add(vecCases, "invalid utf8 " + std::to_string(uiPad) + "/" + std::to_string(uiCnt), "[\"" + std::string(uiPad, 'a') + apcUtf8[uiCnt] + "\"]", false);
+        }
+    }
+    // Every prefix of a document spanning several blocks
+    std::string strDocument = "{\"name\":\"value \\\"quoted\\\" \\\\\",\"list\":[1,-2,3.5e10,true,false,null],"
+                              "\"nested\":{\"path\\\\\\\\\":\"\\u00e9\xc3\xa9\",\"empty\":[],\"object\":{}},\"last\":\"\\\\\"}";
+    for(size_t ulLength = 0; ulLength <= strDocument.size(); ++ulLength)
+    {
+        add(vecCases, "prefix " + std::to_string(ulLength), strDocument.substr(0, ulLength));
+    }
+
+    // Return processing result
+    return vecCases;
+}
+
+/**
+ * @brief Compare the SIMD front-end with the rapidjson reader on one case
+ *
+ * The scanner validates UTF-8: its document is compared with the one of the
+ * reader validating the encoding. The PARSER modes of the class are then
+ * compared (return codes and output); the READER mode does not validate the
+ * encoding by default, so only the SIMD mode is checked on invalid UTF-8.
+ *
+ * @param testCase Test case
+ * @return int Processing result
+ */
+static int compare(const stCase& testCase)
+{
+    int                                    iRet       = 0;
+    utilities::scanner                     scanner;
+    ::rapidjson::Document                  docReader;
+    ::rapidjson::Document                  docScanner;
+    utilities::rapidjson                   jsonReader;
+    utilities::rapidjson                   jsonSimd;
+    utilities::rapidjson::stFormat         format;
+    ::rapidjson::StringBuffer              bufferReader;
+    ::rapidjson::StringBuffer              bufferSimd;
+    const char*                            pcText     = testCase.strText.data();
+    size_t                                 ulSize     = testCase.strText.size();
+
+    // Documents of the scanner and of the validating reader
+    bool bReader  = !docReader.Parse<::rapidjson::kParseValidateEncodingFlag>(pcText, ulSize).HasParseError();
+    bool bScanner = (scanner.parse(docScanner, pcText, ulSize) == 0);
+    if((bReader != bScanner) ||
+       ((bReader) && (docReader != docScanner)))
+    {
+        iRet = -1;
+    }
+    // PARSER modes of the class
+    format.eFormat = utilities::rapidjson::FORMAT::COMPACT;
+    jsonReader.parser(utilities::rapidjson::PARSER::READER);
+    jsonSimd.parser(utilities::rapidjson::PARSER::SIMD);
+    int iReader = jsonReader.set(pcText, ulSize);
+    int iSimd   = jsonSimd.set(pcText, ulSize);
+    if(!testCase.bUtf8)
+    {
+        iRet = (iSimd != 0)? iRet: -1;
+    }
+    else if(iReader != iSimd)
+    {
+        iRet = -1;
+    }
+    else if((!iReader) &&
+            ((jsonReader.get(bufferReader, format) != 0) ||
+             (jsonSimd.get(bufferSimd, format) != 0) ||
+             (std::string(bufferReader.GetString(), bufferReader.GetSize()) != std::string(bufferSimd.GetString(), bufferSimd.GetSize()))))
+    {
+        iRet = -1;
+    }
+
+    // Return processing result
+    return iRet;
+}
+
+/**
+ * @brief Test entry point
+ *
+ * @return int Processing result
+ */
+int main()
+{
+    int                      iRet       = 0;
+    std::vector<stCase>      vecCases   = corpus();
+    std::vector<std::string> vecKernels = utilities::scanner::kernels();
+
+    for(const std::string& strKernel : vecKernels)
+    {
+        uint32_t uiFailures = 0;
+        if(utilities::scanner::kernel(strKernel) != 0)
+        {
+            printf("FAIL kernel %s can not be selected\n", strKernel.c_str());
+            uiFailures++;
+        }
+        for(const stCase& testCase : vecCases)
+        {
+            if(compare(testCase) != 0)
+            {
+                if(uiFailures < TEST_REPORTED)
+                {
+                    printf("FAIL %s: %s\n", strKernel.c_str(), testCase.strName.c_str());
+                }
+                uiFailures++;
+            }
+        }
+        printf("%s %zu cases, %u failures\n", strKernel.c_str(), vecCases.size(), uiFailures);
+        iRet = uiFailures? -1: iRet;
+    }
+    printf("%s test_scanner\n", iRet? "FAIL": "PASS");
+
+    // Return processing result
+    return iRet? 1: 0;
+}